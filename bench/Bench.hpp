@@ -0,0 +1,90 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/**
+ * @file Bench.hpp
+ * @brief Minimal timing helpers shared by the benchmark executables.
+ */
+
+namespace bench
+{
+    /**
+     * @brief Prevents the optimizer from discarding a computed value.
+     * @param value Value to keep alive.
+     */
+    template <typename T>
+    inline void doNotOptimize(T const &value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void *sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief Runs a callable and returns the elapsed wall time in nanoseconds.
+     * @param fn Callable to run.
+     * @return Elapsed time in nanoseconds.
+     */
+    template <typename F>
+    inline double timeNs(F &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+
+    /**
+     * @brief Runs a callable several times and returns the best time in nanoseconds.
+     * @param repeats Number of runs.
+     * @param fn Callable to run.
+     * @return Fastest elapsed time in nanoseconds.
+     */
+    template <typename F>
+    inline double bestOfNs(int repeats, F &&fn)
+    {
+        double best = timeNs(fn);
+        for (int r = 1; r < repeats; ++r)
+        {
+            double t = timeNs(fn);
+            if (t < best)
+                best = t;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Prints one benchmark result line as "name  ns/op  Mops/s".
+     * @param name Benchmark name.
+     * @param ns Total elapsed time in nanoseconds.
+     * @param ops Number of operations performed.
+     */
+    inline void report(const std::string &name, double ns, std::size_t ops)
+    {
+        double nsPerOp = ns / static_cast<double>(ops);
+        std::cout << std::left << std::setw(48) << name
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(2) << nsPerOp << " ns/op"
+                  << std::setw(12) << std::setprecision(1) << 1e3 / nsPerOp << " Mops/s" << std::endl;
+    }
+
+    /**
+     * @brief Prints one benchmark result line as "name  ns/elem  GB/s".
+     * @param name Benchmark name.
+     * @param ns Total elapsed time in nanoseconds.
+     * @param elems Number of elements processed.
+     * @param bytes Number of bytes read and written.
+     */
+    inline void reportBandwidth(const std::string &name, double ns, std::size_t elems, std::size_t bytes)
+    {
+        std::cout << std::left << std::setw(48) << name
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(3) << ns / static_cast<double>(elems) << " ns/elem"
+                  << std::setw(10) << std::setprecision(2) << static_cast<double>(bytes) / ns << " GB/s" << std::endl;
+    }
+}
@@ -0,0 +1,189 @@
+#pragma once
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file PerfCounters.hpp
+ * @brief Hardware performance counters around a block of code, read through
+ *        Linux perf_event_open.
+ *
+ * Each counter is opened on its own for the calling thread, user space only, so
+ * a counter the CPU or kernel does not offer (virtual machines, containers,
+ * perf_event_paranoid > 2) is simply reported as unavailable instead of
+ * disabling the rest. Values are scaled for multiplexing when the kernel could
+ * not keep every counter on the PMU the whole time. On other systems every
+ * counter is unavailable.
+ */
+
+namespace bench
+{
+    /**
+     * @brief Hardware events measured by PerfCounters.
+     */
+    enum class Counter
+    {
+        Cycles,
+        Instructions,
+        BranchMisses,
+        L1dMisses, ///< L1 data cache read misses
+        LlcMisses, ///< Last-level cache misses
+        Count
+    };
+
+    /// Short display name of a counter.
+    inline const char *counterName(Counter c)
+    {
+        static const char *names[] = {"cycles", "instr", "br-miss", "L1d-miss", "LLC-miss"};
+        return names[static_cast<int>(c)];
+    }
+
+    /**
+     * @brief Counter values of one measurement; missing counters are marked invalid.
+     */
+    struct CounterSample
+    {
+        static constexpr int N = static_cast<int>(Counter::Count);
+
+        double values[N] = {};
+        bool valid[N] = {};
+
+        bool has(Counter c) const { return valid[static_cast<int>(c)]; }
+        double operator[](Counter c) const { return values[static_cast<int>(c)]; }
+    };
+
+    /**
+     * @brief Set of per-thread hardware counters.
+     */
+    class PerfCounters
+    {
+    private:
+        static constexpr int N = CounterSample::N;
+        int fds[N];
+        int error = 0; ///< errno of the first counter that failed to open
+
+#if defined(__linux__)
+        static int open(std::uint32_t type, std::uint64_t config)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+#endif
+
+    public:
+        PerfCounters()
+        {
+            for (int &fd : fds)
+                fd = -1;
+#if defined(__linux__)
+            const std::uint64_t l1dRead = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            const std::pair<std::uint32_t, std::uint64_t> events[N] = {
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+                {PERF_TYPE_HW_CACHE, l1dRead},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}};
+            for (int i = 0; i < N; ++i)
+            {
+                fds[i] = open(events[i].first, events[i].second);
+                if (fds[i] < 0 && !error)
+                    error = errno;
+            }
+#endif
+        }
+
+        ~PerfCounters()
+        {
+#if defined(__linux__)
+            for (int fd : fds)
+                if (fd >= 0)
+                    close(fd);
+#endif
+        }
+
+        PerfCounters(const PerfCounters &) = delete;
+        PerfCounters &operator=(const PerfCounters &) = delete;
+
+        /// true if at least one counter could be opened.
+        bool available() const
+        {
+            for (int fd : fds)
+                if (fd >= 0)
+                    return true;
+            return false;
+        }
+
+        /// Reason the first unavailable counter could not be opened, empty if all opened.
+        std::string unavailableReason() const
+        {
+            if (!error)
+                return {};
+            return std::string(std::strerror(error)) + (error == EACCES || error == EPERM ? " (check /proc/sys/kernel/perf_event_paranoid)" : "");
+        }
+
+        /// Resets and starts every open counter.
+        void start()
+        {
+#if defined(__linux__)
+            for (int fd : fds)
+                if (fd >= 0)
+                {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+#endif
+        }
+
+        /// Stops the counters and returns their values since start().
+        CounterSample stop()
+        {
+            CounterSample s;
+#if defined(__linux__)
+            for (int fd : fds)
+                if (fd >= 0)
+                    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            for (int i = 0; i < N; ++i)
+            {
+                std::uint64_t buf[3]; // value, time enabled, time running
+                if (fds[i] < 0 || ::read(fds[i], buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf)) || buf[2] == 0)
+                    continue;
+                s.values[i] = static_cast<double>(buf[0]) * static_cast<double>(buf[1]) / static_cast<double>(buf[2]);
+                s.valid[i] = true;
+            }
+#endif
+            return s;
+        }
+
+        /**
+         * @brief Counts the events of one call of a callable.
+         * @param fn Code to measure.
+         * @return Counter values.
+         */
+        template <typename F>
+        CounterSample measure(F &&fn)
+        {
+            start();
+            fn();
+            return stop();
+        }
+    };
+}
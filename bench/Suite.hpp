@@ -0,0 +1,318 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Bench.hpp"
+
+/**
+ * @file Suite.hpp
+ * @brief Registry of named, size-parameterized benchmarks with console, JSON
+ *        and CSV output, in the spirit of Google Benchmark.
+ *
+ * Each benchmark receives a State holding the input size, does its setup, and
+ * hands the code to time to State::measure(). The suite repeats the timed code
+ * until a run takes at least minimum time, keeps the best of several runs, and
+ * reports ns per item.
+ *
+ * Command line:
+ *   --format=console|json|csv   output format (default console)
+ *   --out=FILE                  write to FILE instead of stdout
+ *   --filter=TEXT               only run benchmarks whose name contains TEXT
+ *   --sizes=N,N,...             input sizes (default L1 to DRAM, see DEFAULT_SIZES)
+ *   --repeats=N                 timed runs per case, best is kept (default 5)
+ *   --min-time-ms=N             minimum duration of one timed run (default 2)
+ */
+
+namespace bench
+{
+    /// Input sizes from L1-resident to DRAM-bound for 8 to 32 byte elements.
+    inline const std::vector<std::size_t> DEFAULT_SIZES = {1 << 8, 1 << 12, 1 << 16, 1 << 20, 1 << 22};
+
+    /**
+     * @brief One measured benchmark case.
+     */
+    struct Result
+    {
+        std::string name;
+        std::size_t size = 0;
+        std::size_t iterations = 0; ///< Calls of the timed code per run
+        std::size_t items = 0;      ///< Items processed per call
+        double bytesPerItem = 0;    ///< 0 when not reported
+        double ns = 0;              ///< Best time of one call
+
+        double nsPerItem() const { return ns / static_cast<double>(items); }
+        double itemsPerSecond() const { return 1e9 / nsPerItem(); }
+        double bytesPerSecond() const { return bytesPerItem * itemsPerSecond(); }
+    };
+
+    /**
+     * @brief Per-case state handed to a benchmark function.
+     */
+    class State
+    {
+    private:
+        std::size_t n;
+        int repeats;
+        double minTimeNs;
+        double bytesPerItem = 0;
+        bool measured = false;
+        std::size_t iterations = 0;
+        std::size_t items = 0;
+        double best = 0;
+
+        friend class Suite;
+
+    public:
+        State(std::size_t n, int repeats, double minTimeNs) : n(n), repeats(repeats), minTimeNs(minTimeNs) {}
+
+        /**
+         * @brief Input size of this case.
+         */
+        std::size_t size() const { return n; }
+
+        /**
+         * @brief Declares the bytes read and written per item, to report bandwidth.
+         */
+        void setBytesPerItem(double bytes) { bytesPerItem = bytes; }
+
+        /**
+         * @brief Times a callable.
+         *
+         * The callable must be repeatable: it is called once to warm up, then in
+         * batches long enough to exceed the minimum run time.
+         *
+         * @param body Code to time.
+         * @param itemsPerCall Items processed by one call; defaults to size().
+         */
+        template <typename F>
+        void measure(F &&body, std::size_t itemsPerCall = 0)
+        {
+            double once = timeNs(body);
+            std::size_t iters = 1;
+            if (once < minTimeNs)
+                iters = static_cast<std::size_t>(minTimeNs / std::max(once, 1.0)) + 1;
+            best = bestOfNs(repeats, [&]
+                            {
+                for (std::size_t i = 0; i < iters; ++i)
+                    body(); }) /
+                   static_cast<double>(iters);
+            iterations = iters;
+            items = itemsPerCall ? itemsPerCall : n;
+            measured = true;
+        }
+    };
+
+    /**
+     * @brief Collection of registered benchmarks and their command-line driver.
+     */
+    class Suite
+    {
+    public:
+        using Function = std::function<void(State &)>;
+
+    private:
+        struct Entry
+        {
+            std::string name;
+            Function fn;
+            std::size_t maxSize;
+        };
+
+        std::vector<Entry> entries;
+
+        static std::string escape(const std::string &s)
+        {
+            std::string out;
+            for (char c : s)
+            {
+                if (c == '"' || c == '\\')
+                    out += '\\';
+                out += c;
+            }
+            return out;
+        }
+
+        static std::string csvField(const std::string &s)
+        {
+            if (s.find_first_of(",\"") == std::string::npos)
+                return s;
+            std::string out = "\"";
+            for (char c : s)
+                out += c == '"' ? std::string("\"\"") : std::string(1, c);
+            return out + "\"";
+        }
+
+        static std::vector<std::size_t> parseSizes(const std::string &list)
+        {
+            std::vector<std::size_t> sizes;
+            std::stringstream ss(list);
+            std::string item;
+            while (std::getline(ss, item, ','))
+                sizes.push_back(std::stoull(item));
+            if (sizes.empty())
+                throw(std::runtime_error("--sizes needs at least one value"));
+            return sizes;
+        }
+
+        static void writeConsole(std::ostream &os, const Result &r)
+        {
+            std::ostringstream name;
+            name << r.name << "/" << r.size;
+            os << std::left << std::setw(52) << name.str()
+               << std::right << std::setw(12) << std::fixed << std::setprecision(3) << r.nsPerItem() << " ns/item"
+               << std::setw(12) << std::setprecision(1) << r.itemsPerSecond() / 1e6 << " M/s";
+            if (r.bytesPerItem > 0)
+                os << std::setw(10) << std::setprecision(2) << r.bytesPerSecond() / 1e9 << " GB/s";
+            os << std::endl;
+        }
+
+        static void writeJson(std::ostream &os, const std::vector<Result> &results)
+        {
+            std::time_t now = std::time(nullptr);
+            char date[32];
+            std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+            os << "{\n  \"context\": {\n"
+               << "    \"date\": \"" << date << "\",\n"
+               << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#if defined(__VERSION__)
+               << "    \"compiler\": \"" << escape(__VERSION__) << "\",\n"
+#endif
+#if defined(__OPTIMIZE__)
+               << "    \"optimized\": true\n"
+#else
+               << "    \"optimized\": false\n"
+#endif
+               << "  },\n  \"benchmarks\": [";
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                const Result &r = results[i];
+                os << (i ? "," : "") << "\n    {"
+                   << "\"name\": \"" << escape(r.name) << "/" << r.size << "\", "
+                   << "\"run_name\": \"" << escape(r.name) << "\", "
+                   << "\"size\": " << r.size << ", "
+                   << "\"iterations\": " << r.iterations << ", "
+                   << std::setprecision(6) << std::defaultfloat
+                   << "\"real_time\": " << r.ns << ", "
+                   << "\"time_unit\": \"ns\", "
+                   << "\"ns_per_item\": " << r.nsPerItem() << ", "
+                   << "\"items_per_second\": " << r.itemsPerSecond();
+                if (r.bytesPerItem > 0)
+                    os << ", \"bytes_per_second\": " << r.bytesPerSecond();
+                os << "}";
+            }
+            os << "\n  ]\n}" << std::endl;
+        }
+
+        static void writeCsv(std::ostream &os, const std::vector<Result> &results)
+        {
+            os << "name,size,iterations,real_time_ns,ns_per_item,items_per_second,bytes_per_second\n"
+               << std::setprecision(6) << std::defaultfloat;
+            for (const Result &r : results)
+                os << csvField(r.name) << "," << r.size << "," << r.iterations << "," << r.ns << ","
+                   << r.nsPerItem() << "," << r.itemsPerSecond() << ","
+                   << (r.bytesPerItem > 0 ? r.bytesPerSecond() : 0.0) << "\n";
+            os.flush();
+        }
+
+    public:
+        /**
+         * @brief Registers a benchmark.
+         * @param name Benchmark name; results are reported as "name/size".
+         * @param fn Benchmark function.
+         * @param maxSize Largest input size to run it with, for expensive cases.
+         */
+        void add(std::string name, Function fn, std::size_t maxSize = SIZE_MAX)
+        {
+            entries.push_back({std::move(name), std::move(fn), maxSize});
+        }
+
+        /**
+         * @brief Parses the command line, runs the selected benchmarks and writes the results.
+         * @return Process exit code.
+         */
+        int run(int argc, char **argv)
+        {
+            std::string format = "console", out, filter;
+            std::vector<std::size_t> sizes = DEFAULT_SIZES;
+            int repeats = 5;
+            double minTimeNs = 2e6;
+            try
+            {
+                for (int i = 1; i < argc; ++i)
+                {
+                    std::string arg = argv[i];
+                    auto value = [&](const std::string &flag)
+                    { return arg.rfind(flag + "=", 0) == 0 ? arg.substr(flag.size() + 1) : std::string(); };
+                    if (!value("--format").empty())
+                        format = value("--format");
+                    else if (!value("--out").empty())
+                        out = value("--out");
+                    else if (!value("--filter").empty())
+                        filter = value("--filter");
+                    else if (!value("--sizes").empty())
+                        sizes = parseSizes(value("--sizes"));
+                    else if (!value("--repeats").empty())
+                        repeats = std::max(1, std::stoi(value("--repeats")));
+                    else if (!value("--min-time-ms").empty())
+                        minTimeNs = std::stod(value("--min-time-ms")) * 1e6;
+                    else
+                        throw(std::runtime_error("Unknown argument: " + arg));
+                }
+                if (format != "console" && format != "json" && format != "csv")
+                    throw(std::runtime_error("Unknown format: " + format));
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << e.what() << std::endl;
+                return 1;
+            }
+
+            std::ofstream file;
+            if (!out.empty())
+            {
+                file.open(out);
+                if (!file)
+                {
+                    std::cerr << "Can't open " << out << std::endl;
+                    return 1;
+                }
+            }
+            std::ostream &os = out.empty() ? std::cout : file;
+
+            std::vector<Result> results;
+            for (const Entry &e : entries)
+            {
+                if (e.name.find(filter) == std::string::npos)
+                    continue;
+                for (std::size_t n : sizes)
+                {
+                    if (n > e.maxSize)
+                        continue;
+                    State state(n, repeats, minTimeNs);
+                    e.fn(state);
+                    if (!state.measured)
+                        continue;
+                    results.push_back({e.name, n, state.iterations, state.items, state.bytesPerItem, state.best});
+                    if (format == "console")
+                        writeConsole(os, results.back());
+                    else
+                        std::cerr << results.back().name << "/" << n << std::endl;
+                }
+            }
+
+            if (format == "json")
+                writeJson(os, results);
+            else if (format == "csv")
+                writeCsv(os, results);
+            return 0;
+        }
+    };
+}
@@ -0,0 +1,88 @@
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <optional>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+
+/**
+ * @file bench_arena.cpp
+ * @brief Mixed-type operator+ / operator- loops with results on the heap versus in a
+ *        NumericArena. Every call into the global allocator is counted.
+ *
+ * Build: g++ -std=c++17 -O2 bench/bench_arena.cpp -o bench_arena
+ */
+
+namespace
+{
+    std::atomic<std::size_t> mallocs{0};
+}
+
+void *operator new(std::size_t size)
+{
+    mallocs.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return ::operator new(size); }
+
+// Kept out of line: inlined, GCC sees free() on a pointer from operator new and warns
+[[gnu::noinline]] void operator delete(void *p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete[](void *p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+    constexpr std::size_t N = 1 << 20;
+    constexpr std::size_t BATCH = 4096;
+
+    /// Evaluates (a[i] + b[i]) - a[i] for every element in batches of BATCH.
+    void run(const std::string &name, bool useArena)
+    {
+        std::vector<std::unique_ptr<myStd::Numeric>> a, b;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            a.push_back(std::make_unique<myStd::Type<int>>(static_cast<int>(i)));
+            b.push_back(std::make_unique<myStd::Type<double>>(0.5));
+        }
+
+        myStd::NumericArena arena(BATCH * 2 * 64);
+        myStd::resetAllocStats();
+        std::size_t before = mallocs.load();
+        double ns = bench::timeNs([&]
+                                  {
+            for (std::size_t start = 0; start < N; start += BATCH)
+            {
+                {
+                    std::optional<myStd::ArenaScope> scope;
+                    if (useArena)
+                        scope.emplace(arena);
+                    for (std::size_t i = start; i < start + BATCH; ++i)
+                    {
+                        auto sum = *a[i] + *b[i];
+                        auto diff = *sum - *a[i];
+                        bench::doNotOptimize(diff);
+                    }
+                }
+                arena.release();
+            } });
+        std::size_t calls = mallocs.load() - before;
+        auto stats = myStd::allocStats();
+        bench::report(name, ns, N);
+        std::cout << "    malloc calls: " << calls
+                  << ", Numeric from heap: " << stats.heap
+                  << ", Numeric from arena: " << stats.arena << std::endl;
+    }
+}
+
+int main()
+{
+    run("heap results", false);
+    run("arena results", true);
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Atomic.hpp"
+
+/**
+ * @file bench_atomic.cpp
+ * @brief Shared accumulators under contention: a mutex around Type<T> against
+ *        AtomicType<T> and StripedAccumulator<T>, from 1 to N writing threads.
+ *
+ * Build: g++ -std=c++17 -O2 -pthread bench/bench_atomic.cpp -o bench_atomic
+ * Usage: bench_atomic [max threads] [adds per thread]
+ */
+
+namespace
+{
+    constexpr std::size_t ADDS = 1 << 20;
+    constexpr int REPEATS = 3;
+
+    using C = myStd::Complex<double, double>;
+
+    /// 1, 2, 4, ... up to max, always ending with max itself.
+    std::vector<unsigned> threadCounts(unsigned max)
+    {
+        std::vector<unsigned> counts;
+        for (unsigned t = 1; t < max; t *= 2)
+            counts.push_back(t);
+        counts.push_back(max);
+        return counts;
+    }
+
+    /// Runs body(i) ADDS times on each of `threads` threads, started together.
+    template <typename F>
+    double contended(unsigned threads, std::size_t adds, F body)
+    {
+        return bench::bestOfNs(REPEATS, [&]
+                               {
+            std::vector<std::thread> workers;
+            for (unsigned t = 0; t < threads; ++t)
+                workers.emplace_back([&]
+                                     {
+                    for (std::size_t i = 0; i < adds; ++i)
+                        body(i); });
+            for (auto &w : workers)
+                w.join(); });
+    }
+
+    void check(const char *name, double got, double expected)
+    {
+        if (got != expected)
+            std::printf("  %s: total %.17g, expected %.17g\n", name, got, expected);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned maxThreads = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : std::thread::hardware_concurrency();
+    std::size_t adds = argc > 2 ? static_cast<std::size_t>(std::atoll(argv[2])) : ADDS;
+    if (maxThreads == 0)
+        maxThreads = 1;
+
+    for (unsigned threads : threadCounts(maxThreads))
+    {
+        std::size_t total = threads * adds;
+        std::string suffix = " x" + std::to_string(threads);
+
+        {
+            std::mutex m;
+            myStd::Type<double> acc(0.0);
+            myStd::Type<double> one(1.0);
+            double ns = contended(threads, adds, [&](std::size_t)
+                                  {
+                std::lock_guard<std::mutex> lock(m);
+                acc += one; });
+            bench::report("mutex + Type<double>" + suffix, ns, total);
+        }
+        {
+            myStd::AtomicType<double> acc;
+            double ns = contended(threads, adds, [&](std::size_t)
+                                  { acc += 1.0; });
+            bench::report("AtomicType<double>" + suffix, ns, total);
+        }
+        {
+            myStd::AtomicType<int> acc;
+            double ns = contended(threads, adds, [&](std::size_t)
+                                  { acc += 1; });
+            bench::report("AtomicType<int>" + suffix, ns, total);
+        }
+        {
+            myStd::StripedAccumulator<double> acc;
+            double ns = contended(threads, adds, [&](std::size_t)
+                                  { acc += 1.0; });
+            bench::report("StripedAccumulator<double>" + suffix, ns, total);
+            acc.reset();
+            contended(threads, adds, [&](std::size_t)
+                      { acc += 1.0; });
+            check("StripedAccumulator<double>", acc.load(), static_cast<double>(total * REPEATS));
+        }
+        {
+            std::mutex m;
+            C acc(0.0, 0.0);
+            double ns = contended(threads, adds, [&](std::size_t)
+                                  {
+                std::lock_guard<std::mutex> lock(m);
+                acc += C(1.0, 2.0); });
+            bench::report("mutex + Complex<double,double>" + suffix, ns, total);
+        }
+        {
+            myStd::StripedAccumulator<C> acc;
+            double ns = contended(threads, adds, [&](std::size_t)
+                                  { acc += C(1.0, 2.0); });
+            bench::report("StripedAccumulator<Complex>" + suffix, ns, total);
+            C s = acc.load();
+            check("StripedAccumulator<Complex> real", s.getReal(), static_cast<double>(total * REPEATS));
+            check("StripedAccumulator<Complex> imag", s.getImg(), 2.0 * static_cast<double>(total * REPEATS));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+
+/**
+ * @file bench_bigint.cpp
+ * @brief BigInt multiplication from 64-bit to 100k-bit operands, the size-picked
+ *        method against the schoolbook product alone, plus addition, division
+ *        and small-value arithmetic against int and Type<int>.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native -pthread bench/bench_bigint.cpp -o bench_bigint
+ */
+
+namespace
+{
+    constexpr std::size_t BITS[] = {64, 128, 256, 1024, 4096, 16384, 65536, 100000};
+    constexpr std::size_t SMALL_N = 1 << 16;
+    constexpr int REPEATS = 5;
+
+    using myStd::BigInt;
+
+    std::mt19937_64 rng(3);
+
+    BigInt random(std::size_t bits)
+    {
+        std::vector<BigInt::Limb> limbs((bits + 63) / 64);
+        for (auto &l : limbs)
+            l = rng();
+        if (bits % 64)
+            limbs.back() >>= 64 - bits % 64;
+        limbs.back() |= BigInt::Limb(1) << ((bits - 1) % 64);
+        return BigInt::fromLimbs(limbs.data(), limbs.size(), false);
+    }
+
+    /// Repetitions that keep one measurement around a millisecond.
+    int repsFor(std::size_t bits)
+    {
+        return bits <= 1024 ? 2000 : bits <= 16384 ? 50 : 3;
+    }
+
+    void sizes()
+    {
+        for (std::size_t bits : BITS)
+        {
+            std::string size = " " + std::to_string(bits) + " bit";
+            BigInt a = random(bits), b = random(bits), p;
+            int reps = repsFor(bits);
+
+            double ns = bench::bestOfNs(REPEATS, [&]
+                                        {
+                for (int i = 0; i < reps; ++i)
+                    p = a * b;
+                bench::doNotOptimize(p); });
+            bench::report("a * b" + size, ns, static_cast<std::size_t>(reps));
+
+            // The quadratic method alone, what a naive implementation would do
+            std::vector<BigInt::Limb> r(a.limbCount() + b.limbCount());
+            ns = bench::bestOfNs(REPEATS, [&]
+                                 {
+                for (int i = 0; i < reps; ++i)
+                    myStd::detail::mulSchoolbook(r.data(), a.data(), a.limbCount(), b.data(), b.limbCount());
+                bench::doNotOptimize(r[0]); });
+            bench::report("schoolbook a * b" + size, ns, static_cast<std::size_t>(reps));
+
+            ns = bench::bestOfNs(REPEATS, [&]
+                                 {
+                for (int i = 0; i < reps; ++i)
+                    p = a + b;
+                bench::doNotOptimize(p); });
+            bench::report("a + b" + size, ns, static_cast<std::size_t>(reps));
+
+            BigInt n = a * b + a, q;
+            ns = bench::bestOfNs(REPEATS, [&]
+                                 {
+                for (int i = 0; i < reps; ++i)
+                    q = n / b;
+                bench::doNotOptimize(q); });
+            bench::report("2n-bit / n-bit" + size, ns, static_cast<std::size_t>(reps));
+        }
+    }
+
+    /// Values that fit in 32 bits: the inline limbs keep BigInt off the heap.
+    void smallValues()
+    {
+        std::vector<int> xs(SMALL_N);
+        for (auto &x : xs)
+            x = static_cast<int>(rng() % 1000) + 1;
+        std::vector<BigInt> bs(xs.begin(), xs.end());
+        std::vector<myStd::Type<int>> ts(xs.begin(), xs.end());
+        std::vector<myStd::Type<BigInt>> tbs(bs.begin(), bs.end());
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            long long s = 0;
+            for (std::size_t i = 0; i < SMALL_N; ++i)
+                s += static_cast<long long>(xs[i]) * xs[SMALL_N - 1 - i];
+            bench::doNotOptimize(s); });
+        bench::report("int multiply-add", ns, SMALL_N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            BigInt s;
+            for (std::size_t i = 0; i < SMALL_N; ++i)
+                s += bs[i] * bs[SMALL_N - 1 - i];
+            bench::doNotOptimize(s); });
+        bench::report("BigInt multiply-add (inline)", ns, SMALL_N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < SMALL_N; ++i)
+                bench::doNotOptimize(ts[i] * ts[SMALL_N - 1 - i]);
+        });
+        bench::report("Type<int> operator*", ns, SMALL_N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < SMALL_N; ++i)
+                bench::doNotOptimize(tbs[i] * ts[SMALL_N - 1 - i]);
+        });
+        bench::report("Type<BigInt> * Type<int>", ns, SMALL_N);
+    }
+}
+
+int main()
+{
+    sizes();
+    smallValues();
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/ComplexMath.hpp"
+#include "../inc/NumericVector.hpp"
+
+/**
+ * @file bench_complex_div.cpp
+ * @brief Complex<double,double> multiply and divide: textbook operators against
+ *        the FMA, Smith and reciprocal-batch kernels of ComplexMath.hpp, on
+ *        interleaved arrays and on split NumericVector storage.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native bench/bench_complex_div.cpp -o bench_complex_div
+ */
+
+namespace
+{
+    using C = myStd::Complex<double, double>;
+
+    constexpr std::size_t N = 1 << 20;
+    constexpr int REPEATS = 5;
+
+    std::vector<C> values(double seed)
+    {
+        std::vector<C> v(N);
+        for (std::size_t i = 0; i < N; ++i)
+            v[i] = C(seed + static_cast<double>(i % 1000), 1.0 - seed * static_cast<double>(i % 37));
+        return v;
+    }
+
+    void interleaved()
+    {
+        const std::vector<C> a = values(1.5), b = values(0.25);
+        std::vector<C> out = a;
+        const C divisor(3.0, -4.0);
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            out = a;
+            for (std::size_t i = 0; i < N; ++i)
+                out[i] *= b[i];
+            bench::doNotOptimize(out); });
+        bench::report("AoS operator*=", ns, N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            out = a;
+            myStd::multiply(out.data(), b.data(), N);
+            bench::doNotOptimize(out); });
+        bench::report("AoS multiply (mulFma)", ns, N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            out = a;
+            for (std::size_t i = 0; i < N; ++i)
+                out[i] /= b[i];
+            bench::doNotOptimize(out); });
+        bench::report("AoS operator/=", ns, N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            out = a;
+            myStd::divide(out.data(), b.data(), N, myStd::Division::Smith);
+            bench::doNotOptimize(out); });
+        bench::report("AoS divide (Smith)", ns, N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            out = a;
+            for (std::size_t i = 0; i < N; ++i)
+                out[i] /= divisor;
+            bench::doNotOptimize(out); });
+        bench::report("AoS operator/= scalar", ns, N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            out = a;
+            myStd::divide(out.data(), N, divisor);
+            bench::doNotOptimize(out); });
+        bench::report("AoS divide scalar (reciprocal)", ns, N);
+    }
+
+    void split()
+    {
+        const std::vector<C> av = values(1.5), bv = values(0.25);
+        myStd::NumericVector<C> a(N), b(N), out;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            a.set(i, av[i]);
+            b.set(i, bv[i]);
+        }
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    { out = a * b; bench::doNotOptimize(out); });
+        bench::report("SoA *", ns, N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { out = a.divide(b, myStd::Division::Fast); bench::doNotOptimize(out); });
+        bench::report("SoA divide (Fast)", ns, N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { out = a.divide(b, myStd::Division::Smith); bench::doNotOptimize(out); });
+        bench::report("SoA divide (Smith)", ns, N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { out = a / C(3.0, -4.0); bench::doNotOptimize(out); });
+        bench::report("SoA / scalar", ns, N);
+    }
+}
+
+int main()
+{
+    interleaved();
+    split();
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <memory>
+#include <random>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+#include "../inc/Value.hpp"
+
+/**
+ * @file bench_dispatch.cpp
+ * @brief Mixed-type +, - and < through the virtual Numeric interface versus the
+ *        std::visit-based Value type. Operand types are drawn at random from
+ *        int, double and the four Complex instantiations.
+ *
+ * Build: g++ -std=c++17 -O2 bench/bench_dispatch.cpp -o bench_dispatch
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 18;
+    constexpr int REPEATS = 5;
+
+    void fill(std::vector<std::unique_ptr<myStd::Numeric>> &legacy, std::vector<myStd::Value> &values)
+    {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> kind(0, 5);
+        std::uniform_int_distribution<int> num(1, 100);
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            int a = num(rng), b = num(rng);
+            switch (kind(rng))
+            {
+            case 0:
+                legacy.push_back(std::make_unique<myStd::Type<int>>(a));
+                values.emplace_back(a);
+                break;
+            case 1:
+                legacy.push_back(std::make_unique<myStd::Type<double>>(a + 0.5));
+                values.emplace_back(a + 0.5);
+                break;
+            case 2:
+                legacy.push_back(std::make_unique<myStd::Type<myStd::Complex<int, int>>>(myStd::Complex<int, int>(a, b)));
+                values.emplace_back(myStd::Complex<int, int>(a, b));
+                break;
+            case 3:
+                legacy.push_back(std::make_unique<myStd::Type<myStd::Complex<double, double>>>(myStd::Complex<double, double>(a, b)));
+                values.emplace_back(myStd::Complex<double, double>(a, b));
+                break;
+            case 4:
+                legacy.push_back(std::make_unique<myStd::Type<myStd::Complex<int, double>>>(myStd::Complex<int, double>(a, b)));
+                values.emplace_back(myStd::Complex<int, double>(a, b));
+                break;
+            default:
+                legacy.push_back(std::make_unique<myStd::Type<myStd::Complex<double, int>>>(myStd::Complex<double, int>(a, b)));
+                values.emplace_back(myStd::Complex<double, int>(a, b));
+                break;
+            }
+        }
+    }
+}
+
+int main()
+{
+    std::vector<std::unique_ptr<myStd::Numeric>> legacy;
+    std::vector<myStd::Value> values;
+    fill(legacy, values);
+
+    double ns = bench::bestOfNs(REPEATS, [&]
+                                {
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            auto r = *legacy[i] + *legacy[i + 1];
+            bench::doNotOptimize(r);
+        } });
+    bench::report("Numeric operator+ (virtual)", ns, N - 1);
+    ns = bench::bestOfNs(REPEATS, [&]
+                         {
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            auto r = values[i] + values[i + 1];
+            bench::doNotOptimize(r);
+        } });
+    bench::report("Value operator+ (std::visit)", ns, N - 1);
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         {
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            auto r = *legacy[i] - *legacy[i + 1];
+            bench::doNotOptimize(r);
+        } });
+    bench::report("Numeric operator- (virtual)", ns, N - 1);
+    ns = bench::bestOfNs(REPEATS, [&]
+                         {
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            auto r = values[i] - values[i + 1];
+            bench::doNotOptimize(r);
+        } });
+    bench::report("Value operator- (std::visit)", ns, N - 1);
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         {
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            bool r = *legacy[i] < *legacy[i + 1];
+            bench::doNotOptimize(r);
+        } });
+    bench::report("Numeric operator< (virtual)", ns, N - 1);
+    ns = bench::bestOfNs(REPEATS, [&]
+                         {
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            bool r = values[i] < values[i + 1];
+            bench::doNotOptimize(r);
+        } });
+    bench::report("Value operator< (std::visit)", ns, N - 1);
+    return 0;
+}
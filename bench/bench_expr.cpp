@@ -0,0 +1,62 @@
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Expr.hpp"
+
+/**
+ * @file bench_expr.cpp
+ * @brief a + b * c - d evaluated eagerly (one temporary per operator) versus as a
+ *        fused expression template, over NumericVectors and over Type<T> scalars.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native bench/bench_expr.cpp -o bench_expr
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 22;
+    constexpr int REPEATS = 5;
+
+    template <typename T>
+    void vectors(const std::string &name, T x)
+    {
+        myStd::NumericVector<T> a(N, x), b(N, x), c(N, x), d(N, x), r(N);
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    { r = a + b * c - d; bench::doNotOptimize(r); });
+        bench::reportBandwidth(name + " eager", ns, N, 5 * N * sizeof(T));
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { myStd::assign(r, myStd::lazy(a) + myStd::lazy(b) * myStd::lazy(c) - myStd::lazy(d));
+                               bench::doNotOptimize(r); });
+        bench::reportBandwidth(name + " fused", ns, N, 5 * N * sizeof(T));
+    }
+
+    void scalars()
+    {
+        constexpr std::size_t M = 1 << 18;
+        std::vector<myStd::Type<double>> a(M, myStd::Type<double>(1.5)), b(a), c(a), d(a);
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            for (std::size_t i = 0; i < M; ++i)
+            {
+                auto bc = b[i] * c[i];
+                auto abc = a[i] + *bc;
+                auto r = *abc - d[i];
+                bench::doNotOptimize(r);
+            } });
+        bench::report("Type<double> a + b * c - d, polymorphic", ns, M);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < M; ++i)
+            {
+                double r = myStd::eval(myStd::lazy(a[i]) + myStd::lazy(b[i]) * myStd::lazy(c[i]) - myStd::lazy(d[i]));
+                bench::doNotOptimize(r);
+            } });
+        bench::report("Type<double> a + b * c - d, fused", ns, M);
+    }
+}
+
+int main()
+{
+    vectors<double>("NumericVector<double> a + b * c - d", 1.5);
+    vectors<myStd::Complex<double, double>>("NumericVector<Complex<d,d>> a + b * c - d", {1.0, 0.5});
+    scalars();
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Fft.hpp"
+
+/**
+ * @file bench_fft.cpp
+ * @brief FFT throughput at sizes 2^8..2^22 against a naive DFT built from
+ *        Complex::operator* and operator+, plus the real-input path.
+ *
+ * Results are reported per transform and as "FFT GFLOP/s", 5 n log2(n) / time,
+ * the usual normalization for comparing FFT implementations. The naive DFT is
+ * O(n^2) and only run up to NAIVE_MAX.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native bench/bench_fft.cpp -o bench_fft
+ */
+
+namespace
+{
+    constexpr unsigned MIN_LOG2 = 8;
+    constexpr unsigned MAX_LOG2 = 22;
+    constexpr std::size_t NAIVE_MAX = 1 << 12;
+    constexpr int REPEATS = 5;
+    constexpr double TWO_PI = 6.283185307179586476925286766559;
+
+    using C = myStd::Complex<double, double>;
+
+    /// X[k] = sum x[j] w^(jk), with w^(jk) looked up in a table of n roots.
+    void naiveDft(const C *x, C *out, std::size_t n, const std::vector<C> &roots)
+    {
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            C acc(0.0, 0.0);
+            for (std::size_t j = 0, t = 0; j < n; ++j, t = (t + k) % n)
+                acc = acc + x[j] * roots[t];
+            out[k] = acc;
+        }
+    }
+
+    void reportFft(const std::string &name, double ns, std::size_t n)
+    {
+        double flops = 5.0 * static_cast<double>(n) * std::log2(static_cast<double>(n));
+        std::printf("%-40s %14.1f us %10.2f GFLOP/s\n", name.c_str(), ns / 1e3, flops / ns);
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    for (unsigned lg = MIN_LOG2; lg <= MAX_LOG2; ++lg)
+    {
+        std::size_t n = std::size_t(1) << lg;
+        std::string size = " 2^" + std::to_string(lg);
+        std::vector<C> x(n), out(n);
+        std::vector<double> real(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x[i] = C(dist(rng), dist(rng));
+            real[i] = dist(rng);
+        }
+
+        const auto &plan = myStd::fftPlan<double>(n);
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            plan.forward(x.data(), out.data());
+            bench::doNotOptimize(out[0]); });
+        reportFft("fft out-of-place" + size, ns, n);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            plan.forward(out.data());
+            bench::doNotOptimize(out[0]); });
+        reportFft("fft in-place" + size, ns, n);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            plan.inverse(out.data());
+            bench::doNotOptimize(out[0]); });
+        reportFft("ifft in-place" + size, ns, n);
+
+        std::vector<C> bins(n / 2 + 1);
+        const auto &realPlan = myStd::realFftPlan<double>(n);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            realPlan.forward(real.data(), bins.data());
+            bench::doNotOptimize(bins[0]); });
+        reportFft("rfft (real input)" + size, ns, n);
+
+        if (n <= NAIVE_MAX)
+        {
+            std::vector<C> roots(n);
+            for (std::size_t t = 0; t < n; ++t)
+            {
+                double angle = -TWO_PI * static_cast<double>(t) / static_cast<double>(n);
+                roots[t] = C(std::cos(angle), std::sin(angle));
+            }
+            ns = bench::bestOfNs(1, [&]
+                                 {
+                naiveDft(x.data(), out.data(), n, roots);
+                bench::doNotOptimize(out[0]); });
+            reportFft("naive DFT (Complex ops)" + size, ns, n);
+        }
+    }
+    return 0;
+}
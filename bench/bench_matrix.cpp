@@ -0,0 +1,131 @@
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Matrix.hpp"
+
+/**
+ * @file bench_matrix.cpp
+ * @brief GEMM throughput for square matrices of double, float and
+ *        Complex<double, double> against the hand-rolled triple loop, single
+ *        and multi-threaded, plus gemv and transpose.
+ *
+ * GEMM is reported in GFLOP/s: 2 n^3 for real and 8 n^3 for complex. The triple
+ * loop is O(n^3) with strided access to B and only run up to NAIVE_MAX.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native -pthread bench/bench_matrix.cpp -o bench_matrix
+ * Usage: bench_matrix [threads]
+ */
+
+namespace
+{
+    constexpr std::size_t SIZES[] = {64, 128, 256, 512, 1024, 2048};
+    constexpr std::size_t NAIVE_MAX = 512;
+    constexpr int REPEATS = 3;
+
+    using C = myStd::Complex<double, double>;
+
+    template <typename T>
+    myStd::Matrix<T> random(std::size_t n, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        myStd::Matrix<T> m(n, n);
+        for (std::size_t i = 0; i < m.size(); ++i)
+        {
+            if constexpr (is_complex_v<T>)
+                m.raw()[i] = T(dist(rng), dist(rng));
+            else
+                m.raw()[i] = static_cast<T>(dist(rng));
+        }
+        return m;
+    }
+
+    /// The loop this replaces: c(i, j) = sum over k of a(i, k) * b(k, j).
+    template <typename T>
+    void tripleLoop(const myStd::Matrix<T> &a, const myStd::Matrix<T> &b, myStd::Matrix<T> &c)
+    {
+        std::size_t n = a.rows();
+        for (std::size_t i = 0; i < n; ++i)
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                T s{};
+                for (std::size_t k = 0; k < n; ++k)
+                    s = s + a(i, k) * b(k, j);
+                c(i, j) = s;
+            }
+    }
+
+    void reportFlops(const std::string &name, double ns, double flops)
+    {
+        std::printf("%-44s %12.1f us %10.2f GFLOP/s\n", name.c_str(), ns / 1e3, flops / ns);
+    }
+
+    template <typename T>
+    void gemmSizes(const std::string &name, double flopsPerMac, myStd::ThreadPool &pool)
+    {
+        for (std::size_t n : SIZES)
+        {
+            std::string size = " " + std::to_string(n);
+            double flops = flopsPerMac * static_cast<double>(n) * static_cast<double>(n) * static_cast<double>(n);
+            auto a = random<T>(n, 1), b = random<T>(n, 2);
+            myStd::Matrix<T> c(n, n);
+
+            double ns = bench::bestOfNs(REPEATS, [&]
+                                        {
+                myStd::gemm(a, b, c);
+                bench::doNotOptimize(c(0, 0)); });
+            reportFlops(name + " gemm" + size, ns, flops);
+
+            myStd::Parallel par{&pool};
+            ns = bench::bestOfNs(REPEATS, [&]
+                                 {
+                myStd::gemm(par, a, b, c);
+                bench::doNotOptimize(c(0, 0)); });
+            reportFlops(name + " gemm x" + std::to_string(pool.size()) + size, ns, flops);
+
+            if (n <= NAIVE_MAX)
+            {
+                ns = bench::bestOfNs(1, [&]
+                                     {
+                    tripleLoop(a, b, c);
+                    bench::doNotOptimize(c(0, 0)); });
+                reportFlops(name + " triple loop" + size, ns, flops);
+            }
+        }
+    }
+
+    void gemvAndTranspose()
+    {
+        constexpr std::size_t n = 4096;
+        auto a = random<double>(n, 3);
+        std::vector<double> x(n, 1.0), y(n);
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            myStd::gemv(a, x.data(), y.data());
+            bench::doNotOptimize(y[0]); });
+        bench::reportBandwidth("gemv double 4096", ns, n * n, n * n * sizeof(double));
+
+        myStd::Matrix<double> t(n, n);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            myStd::transpose(myStd::Sequential{}, a, t);
+            bench::doNotOptimize(t(0, 0)); });
+        bench::reportBandwidth("transpose double 4096", ns, n * n, 2 * n * n * sizeof(double));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned threads = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : std::thread::hardware_concurrency();
+    myStd::ThreadPool pool(threads);
+
+    gemmSizes<double>("double", 2.0, pool);
+    gemmSizes<float>("float", 2.0, pool);
+    gemmSizes<C>("Complex<double>", 8.0, pool);
+    gemvAndTranspose();
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+
+/**
+ * @file bench_move.cpp
+ * @brief Move construction, vector growth and compound-operator throughput of Type<T>,
+ *        with a count of heap allocations made inside each timed loop.
+ *
+ * Build: g++ -std=c++17 -O2 bench/bench_move.cpp -o bench_move
+ */
+
+namespace
+{
+    std::atomic<std::size_t> allocations{0};
+}
+
+void *operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return ::operator new(size); }
+
+// Kept out of line: inlined, GCC sees free() on a pointer from operator new and warns
+[[gnu::noinline]] void operator delete(void *p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete[](void *p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+    constexpr std::size_t N = 1 << 20;
+    constexpr int REPEATS = 5;
+
+    static_assert(std::is_nothrow_move_constructible_v<myStd::Type<double>>,
+                  "std::vector must be able to relocate Type<T> by moving");
+
+    void reportWithAllocs(const std::string &name, double ns, std::size_t ops, std::size_t allocs)
+    {
+        bench::report(name, ns, ops);
+        std::cout << "    allocations in loop: " << allocs << std::endl;
+    }
+
+    template <typename T>
+    void run(const std::string &name, T seed)
+    {
+        std::vector<myStd::Type<T>> src(N, myStd::Type<T>(seed));
+
+        std::size_t before = allocations.load();
+        double ns = bench::timeNs([&]
+                                  {
+            std::vector<myStd::Type<T>> grown;
+            for (std::size_t i = 0; i < N; ++i)
+                grown.push_back(std::move(src[i]));
+            src = std::move(grown); });
+        reportWithAllocs(name + " push_back(move)", ns, N, allocations.load() - before);
+
+        myStd::Type<T> acc(seed);
+        before = allocations.load();
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < N; ++i)
+                acc += src[i];
+            bench::doNotOptimize(acc); });
+        reportWithAllocs(name + " operator+= (Type<T>&)", ns, N, allocations.load() - before);
+
+        myStd::Numeric &accRef = acc;
+        before = allocations.load();
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < N; ++i)
+                accRef -= src[i];
+            bench::doNotOptimize(acc); });
+        reportWithAllocs(name + " operator-= (Numeric&)", ns, N, allocations.load() - before);
+    }
+}
+
+int main()
+{
+    run<int>("Type<int>", 1);
+    run<double>("Type<double>", 1.5);
+    run<myStd::Complex<double, double>>("Type<Complex<double,double>>", {1.0, 2.0});
+    return 0;
+}
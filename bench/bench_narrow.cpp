@@ -0,0 +1,105 @@
+#include <random>
+#include <string>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+#include "../inc/NumericVector.hpp"
+
+/**
+ * @file bench_narrow.cpp
+ * @brief Element-wise throughput of NumericVector at 64, 32 and 16 bits per
+ *        value: double against float, Q31 and Q15, real and complex, plus the
+ *        cost of a mixed float/Q15 operation through Type<T>.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native bench/bench_narrow.cpp -o bench_narrow
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 22;
+    constexpr int REPEATS = 5;
+
+    /// Random samples in [-0.5, 0.5), converted to T.
+    template <typename T>
+    myStd::NumericVector<T> samples(unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(-0.5, 0.5);
+        myStd::NumericVector<double> v(N);
+        for (std::size_t i = 0; i < N; ++i)
+            v.set(i, dist(rng));
+        return v.convert<T>();
+    }
+
+    template <typename T>
+    void real(const std::string &name)
+    {
+        auto a = samples<T>(1), b = samples<T>(2);
+        myStd::NumericVector<T> out;
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            out = a + b;
+            bench::doNotOptimize(out); });
+        bench::reportBandwidth(name + " +", ns, N, 3 * N * sizeof(T));
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            out = a * b;
+            bench::doNotOptimize(out); });
+        bench::reportBandwidth(name + " *", ns, N, 3 * N * sizeof(T));
+    }
+
+    template <typename F>
+    void complex(const std::string &name)
+    {
+        using C = myStd::Complex<F, F>;
+        auto re = samples<F>(3), im = samples<F>(4);
+        myStd::NumericVector<C> a(N), b(N), out;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            a.set(i, C(re[i], im[i]));
+            b.set(i, C(im[i], re[i]));
+        }
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            out = a * b;
+            bench::doNotOptimize(out); });
+        bench::reportBandwidth(name + " *", ns, N, 3 * N * sizeof(C));
+
+        myStd::NumericVector<F> mag;
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            mag = a.getValue();
+            bench::doNotOptimize(mag); });
+        bench::reportBandwidth(name + " magnitude", ns, N, N * (sizeof(C) + sizeof(F)));
+    }
+
+    void mixedType()
+    {
+        constexpr std::size_t M = 1 << 18;
+        myStd::Type<float> f(0.25f);
+        myStd::Type<myStd::Q15> q(myStd::Q15(0.5));
+        myStd::Type<double> d(0.25);
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            for (std::size_t i = 0; i < M; ++i)
+                bench::doNotOptimize(f + q); });
+        bench::report("Type<float> + Type<Q15> -> float", ns, M);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < M; ++i)
+                bench::doNotOptimize(d + q); });
+        bench::report("Type<double> + Type<Q15> -> double", ns, M);
+    }
+}
+
+int main()
+{
+    real<double>("NumericVector<double>");
+    real<float>("NumericVector<float>");
+    real<myStd::Q31>("NumericVector<Q31>");
+    real<myStd::Q15>("NumericVector<Q15>");
+    complex<double>("NumericVector<Complex<double>>");
+    complex<float>("NumericVector<Complex<float>>");
+    mixedType();
+    return 0;
+}
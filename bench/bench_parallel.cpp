@@ -0,0 +1,115 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Parallel.hpp"
+
+/**
+ * @file bench_parallel.cpp
+ * @brief Scaling of parallelTransform and parallelSum from 1 to N threads, with
+ *        a check that deterministic sums are bit-identical at every count.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native -pthread bench/bench_parallel.cpp -o bench_parallel
+ * Usage: bench_parallel [max threads] [elements]
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 24;
+    constexpr int REPEATS = 5;
+
+    using C = myStd::Complex<double, double>;
+
+    /// 1, 2, 4, ... up to max, always ending with max itself.
+    std::vector<unsigned> threadCounts(unsigned max)
+    {
+        std::vector<unsigned> counts;
+        for (unsigned t = 1; t < max; t *= 2)
+            counts.push_back(t);
+        counts.push_back(max);
+        return counts;
+    }
+
+    void reportScaling(const std::string &name, unsigned threads, double ns, double baseNs, std::size_t n, std::size_t bytes)
+    {
+        bench::reportBandwidth(name + " x" + std::to_string(threads), ns, n, bytes);
+        std::printf("%-44s speedup %.2fx\n", "", baseNs / ns);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned maxThreads = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : std::thread::hardware_concurrency();
+    std::size_t n = argc > 2 ? static_cast<std::size_t>(std::atoll(argv[2])) : N;
+    if (maxThreads == 0)
+        maxThreads = 1;
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> x(n), y(n), z(n);
+    std::vector<C> ca(n), cb(n), cc(n);
+    std::vector<myStd::Type<double>> types;
+    types.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = dist(rng);
+        y[i] = dist(rng);
+        ca[i] = C(x[i], y[i]);
+        cb[i] = C(y[i], x[i]);
+        types.emplace_back(x[i]);
+    }
+
+    double baseAxpy = 0, baseMul = 0, baseSum = 0, baseFast = 0, baseTypes = 0;
+    double reference = 0;
+    bool identical = true;
+    for (unsigned threads : threadCounts(maxThreads))
+    {
+        myStd::ThreadPool pool(threads);
+        myStd::Parallel par{&pool};
+        myStd::Parallel fast{&pool, 0, myStd::Reduction::Fast};
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            myStd::parallelTransform(par, x.data(), y.data(), n, z.data(), [](double a, double b)
+                                     { return 2.5 * a + b; });
+            bench::doNotOptimize(z[n / 2]); });
+        baseAxpy = threads == 1 ? ns : baseAxpy;
+        reportScaling("transform axpy double", threads, ns, baseAxpy, n, 3 * n * sizeof(double));
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            myStd::parallelTransform(par, ca.data(), cb.data(), n, cc.data(), [](const C &a, const C &b)
+                                     { return a * b; });
+            bench::doNotOptimize(cc[n / 2]); });
+        baseMul = threads == 1 ? ns : baseMul;
+        reportScaling("transform Complex *", threads, ns, baseMul, n, 3 * n * sizeof(C));
+
+        double s = 0;
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            s = myStd::parallelSum(par, x.data(), n);
+            bench::doNotOptimize(s); });
+        baseSum = threads == 1 ? ns : baseSum;
+        reportScaling("sum double deterministic", threads, ns, baseSum, n, n * sizeof(double));
+        if (threads == 1)
+            reference = s;
+        identical = identical && std::memcmp(&s, &reference, sizeof(s)) == 0;
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { bench::doNotOptimize(myStd::parallelSum(fast, x.data(), n)); });
+        baseFast = threads == 1 ? ns : baseFast;
+        reportScaling("sum double fast", threads, ns, baseFast, n, n * sizeof(double));
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { bench::doNotOptimize(myStd::parallelSum(par, types.data(), n)); });
+        baseTypes = threads == 1 ? ns : baseTypes;
+        reportScaling("sum Type<double>", threads, ns, baseTypes, n, n * sizeof(myStd::Type<double>));
+    }
+
+    std::printf("deterministic sum %s across thread counts (%.17g)\n", identical ? "identical" : "DIFFERS", reference);
+    return identical ? 0 : 1;
+}
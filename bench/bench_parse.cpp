@@ -0,0 +1,101 @@
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Parse.hpp"
+
+/**
+ * @file bench_parse.cpp
+ * @brief Text ingest and output of int, double and Complex<double,double>:
+ *        iostream operator>> / operator<< against parseArray / formatArray.
+ *        Complex values use the "(a + bi)" form written by operator<<.
+ *
+ * Build: g++ -std=c++17 -O2 bench/bench_parse.cpp -o bench_parse
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 20;
+    constexpr int REPEATS = 3;
+
+    using C = myStd::Complex<double, double>;
+
+    /// iostreams have no operator>> for "(a + bi)"; this is the straightforward stream parser.
+    std::istream &readComplex(std::istream &is, C &c)
+    {
+        char open, sign, i, close;
+        double re, im;
+        if (is >> open >> re >> sign >> im >> i >> close)
+            c = C(re, sign == '-' ? -im : im);
+        return is;
+    }
+
+    template <typename T>
+    std::vector<T> values()
+    {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<double> dist(-1e6, 1e6);
+        std::vector<T> v(N);
+        for (auto &x : v)
+        {
+            if constexpr (std::is_same_v<T, C>)
+                x = C(dist(rng), dist(rng));
+            else
+                x = static_cast<T>(dist(rng));
+        }
+        return v;
+    }
+
+    template <typename T>
+    void run(const std::string &name)
+    {
+        const std::vector<T> data = values<T>();
+
+        std::string text;
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            std::ostringstream os;
+            os.precision(17);
+            for (const T &x : data)
+                os << x << '\n';
+            text = os.str(); });
+        bench::report(name + " iostream format", ns, N);
+
+        std::string fast;
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            fast.clear();
+            myStd::formatArray(data.data(), N, fast);
+            bench::doNotOptimize(fast); });
+        bench::report(name + " formatArray (to_chars)", ns, N);
+
+        std::vector<T> back(N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            std::istringstream is(fast);
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if constexpr (std::is_same_v<T, C>)
+                    readComplex(is, back[i]);
+                else
+                    is >> back[i];
+            }
+            bench::doNotOptimize(back); });
+        bench::reportBandwidth(name + " iostream parse", ns, N, fast.size());
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            myStd::parseArray(fast, back.data(), N);
+            bench::doNotOptimize(back); });
+        bench::reportBandwidth(name + " parseArray (from_chars)", ns, N, fast.size());
+    }
+}
+
+int main()
+{
+    run<int>("int");
+    run<double>("double");
+    run<C>("Complex<double,double>");
+    return 0;
+}
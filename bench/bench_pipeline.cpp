@@ -0,0 +1,70 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+#include "../inc/Pipeline.hpp"
+
+/**
+ * @file bench_pipeline.cpp
+ * @brief Filter-map-sum over a text feed of complex values: materialized as a
+ *        std::vector<std::unique_ptr<Numeric>> first, as src/main.cpp stores
+ *        values, against a chunked Pipeline that holds one chunk per stage.
+ *
+ * Build: g++ -std=c++17 -O2 bench/bench_pipeline.cpp -o bench_pipeline
+ */
+
+namespace
+{
+    using C = myStd::Complex<double, double>;
+
+    constexpr std::size_t N = 1 << 20;
+    constexpr int REPEATS = 3;
+
+    std::string feed()
+    {
+        std::string text;
+        std::vector<C> values(N);
+        for (std::size_t i = 0; i < N; ++i)
+            values[i] = C(static_cast<double>(i % 50), static_cast<double>(i % 7));
+        myStd::formatArray(values.data(), N, text);
+        return text;
+    }
+}
+
+int main()
+{
+    const std::string text = feed();
+
+    double ns = bench::bestOfNs(REPEATS, [&]
+                                {
+        std::vector<std::unique_ptr<myStd::Numeric>> all;
+        myStd::Type<C> one(C(0.5, 0));
+        std::istringstream in(text);
+        std::string line;
+        while (std::getline(in, line))
+            all.push_back(std::make_unique<myStd::Type<C>>(myStd::parseValue<C>(line)));
+        double total = 0;
+        for (auto &p : all)
+        {
+            double m = p->getValue();
+            if (m >= 1.0 && m <= 20.0)
+                total += (*p + one)->getValue();
+        }
+        bench::doNotOptimize(total); });
+    bench::reportBandwidth("materialized unique_ptr<Numeric>", ns, N, text.size());
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         {
+        std::istringstream in(text);
+        double total = myStd::fromStream<C>(in)
+                           .filterByMagnitude(1.0, 20.0)
+                           .map([](const C &c)
+                                { return myStd::ops::add(c, 0.5).getValue(); })
+                           .reduce(0.0, [](double a, double b)
+                                   { return a + b; });
+        bench::doNotOptimize(total); });
+    bench::reportBandwidth("Pipeline fromStream", ns, N, text.size());
+    return 0;
+}
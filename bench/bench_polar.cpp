@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Polar.hpp"
+
+/**
+ * @file bench_polar.cpp
+ * @brief PolarComplex against Complex<double, double> for multiply/divide
+ *        chains, integer powers, magnitude reads and sorting by magnitude,
+ *        plus batch toPolar/toRect against std::atan2/std::hypot and
+ *        std::sin/std::cos loops.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native -pthread bench/bench_polar.cpp -o bench_polar
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 20;
+    constexpr int POWER = 12;
+    constexpr int REPEATS = 5;
+
+    using C = myStd::Complex<double, double>;
+    using P = myStd::PolarComplex<double>;
+
+    std::vector<C> randomComplex(std::size_t n)
+    {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        std::vector<C> v(n);
+        for (auto &c : v)
+            c = C(dist(rng), dist(rng));
+        return v;
+    }
+
+    void arithmetic(const std::vector<C> &rect, const std::vector<P> &polar)
+    {
+        std::vector<C> rOut(N);
+        std::vector<P> pOut(N);
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            for (std::size_t i = 1; i < N; ++i)
+                rOut[i] = rect[i] * rect[i - 1] / rect[i];
+            bench::doNotOptimize(rOut[1]); });
+        bench::report("Complex a * b / a", ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 1; i < N; ++i)
+                pOut[i] = polar[i] * polar[i - 1] / polar[i];
+            bench::doNotOptimize(pOut[1]); });
+        bench::report("PolarComplex a * b / a", ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                C acc = rect[i];
+                for (int k = 1; k < POWER; ++k)
+                    acc = acc * rect[i];
+                rOut[i] = acc;
+            }
+            bench::doNotOptimize(rOut[0]); });
+        bench::report("Complex z^12 by repeated multiply", ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < N; ++i)
+                pOut[i] = myStd::pow(polar[i], POWER);
+            bench::doNotOptimize(pOut[0]); });
+        bench::report("PolarComplex pow(z, 12)", ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            double s = 0.0;
+            for (const auto &c : rect)
+                s += c.getValue();
+            bench::doNotOptimize(s); });
+        bench::report("Complex getValue (sqrt)", ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            double s = 0.0;
+            for (const auto &p : polar)
+                s += p.getValue();
+            bench::doNotOptimize(s); });
+        bench::report("PolarComplex getValue (field read)", ns, N);
+    }
+
+    void sorting(const std::vector<C> &rect, const std::vector<P> &polar)
+    {
+        std::vector<C> r;
+        std::vector<P> p;
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            r = rect;
+            std::sort(r.begin(), r.end(), [](const C &a, const C &b)
+                      { return a.getValue() < b.getValue(); });
+            bench::doNotOptimize(r[0]); });
+        bench::report("sort Complex by getValue", ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            p = polar;
+            std::sort(p.begin(), p.end());
+            bench::doNotOptimize(p[0]); });
+        bench::report("sort PolarComplex by operator<", ns, N);
+    }
+
+    void conversions(const std::vector<C> &rect)
+    {
+        std::vector<double> re(N), im(N), mag(N), angle(N);
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            re[i] = rect[i].getReal();
+            im[i] = rect[i].getImg();
+        }
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                mag[i] = std::hypot(re[i], im[i]);
+                angle[i] = std::atan2(im[i], re[i]);
+            }
+            bench::doNotOptimize(angle[0]); });
+        bench::reportBandwidth("std::hypot + std::atan2 loop", ns, N, 4 * N * sizeof(double));
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            myStd::toPolar(re.data(), im.data(), mag.data(), angle.data(), N);
+            bench::doNotOptimize(angle[0]); });
+        bench::reportBandwidth("toPolar split arrays", ns, N, 4 * N * sizeof(double));
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                re[i] = mag[i] * std::cos(angle[i]);
+                im[i] = mag[i] * std::sin(angle[i]);
+            }
+            bench::doNotOptimize(re[0]); });
+        bench::reportBandwidth("std::cos + std::sin loop", ns, N, 4 * N * sizeof(double));
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            myStd::toRect(mag.data(), angle.data(), re.data(), im.data(), N);
+            bench::doNotOptimize(re[0]); });
+        bench::reportBandwidth("toRect split arrays", ns, N, 4 * N * sizeof(double));
+
+        std::vector<P> polar(N);
+        std::vector<C> back(N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            myStd::toPolar(rect.data(), polar.data(), N);
+            bench::doNotOptimize(polar[0]); });
+        bench::reportBandwidth("toPolar Complex -> PolarComplex", ns, N, 2 * N * sizeof(C));
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            myStd::toRect(polar.data(), back.data(), N);
+            bench::doNotOptimize(back[0]); });
+        bench::reportBandwidth("toRect PolarComplex -> Complex", ns, N, 2 * N * sizeof(C));
+    }
+}
+
+int main()
+{
+    std::vector<C> rect = randomComplex(N);
+    std::vector<P> polar(N);
+    myStd::toPolar(rect.data(), polar.data(), N);
+
+    arithmetic(rect, polar);
+    sorting(rect, polar);
+    conversions(rect);
+    return 0;
+}
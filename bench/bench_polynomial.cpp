@@ -0,0 +1,136 @@
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Polynomial.hpp"
+
+/**
+ * @file bench_polynomial.cpp
+ * @brief Polynomial evaluation over 2^20 real and complex points, Horner and
+ *        Estrin against a Horner loop over Complex::operator* and operator+,
+ *        and batched Aberth root finding against one polynomial at a time.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native -pthread bench/bench_polynomial.cpp -o bench_polynomial
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 20;
+    constexpr std::size_t DEGREES[] = {4, 8, 16, 32};
+    constexpr std::size_t ROOT_POLYS = 4096;
+    constexpr std::size_t ROOT_DEGREE = 16;
+    constexpr int REPEATS = 5;
+
+    using C = myStd::Complex<double, double>;
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::vector<C> randomComplex(std::size_t n)
+    {
+        std::vector<C> v(n);
+        for (auto &c : v)
+            c = C(dist(rng), dist(rng));
+        return v;
+    }
+
+    /// What the evaluation replaces: Horner's rule through Complex operators.
+    void complexOps(const std::vector<C> &coeffs, const C *x, C *out, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            C acc = coeffs.back();
+            for (std::size_t k = coeffs.size() - 1; k-- > 0;)
+                acc = acc * x[i] + coeffs[k];
+            out[i] = acc;
+        }
+    }
+
+    void evaluation(std::size_t degree)
+    {
+        std::string deg = " deg " + std::to_string(degree);
+        std::vector<double> realCoeffs(degree + 1), xs(N), ys(N);
+        for (auto &c : realCoeffs)
+            c = dist(rng);
+        for (auto &x : xs)
+            x = dist(rng);
+        std::vector<C> coeffs = randomComplex(degree + 1), zs = randomComplex(N), out(N);
+        myStd::Polynomial<double> p(realCoeffs);
+        myStd::Polynomial<C> q(coeffs);
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            p.evaluate(xs.data(), ys.data(), N);
+            bench::doNotOptimize(ys[0]); });
+        bench::report("real p, real x, Horner" + deg, ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            p.evaluate(xs.data(), ys.data(), N, myStd::Scheme::Estrin);
+            bench::doNotOptimize(ys[0]); });
+        bench::report("real p, real x, Estrin" + deg, ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            complexOps(coeffs, zs.data(), out.data(), N);
+            bench::doNotOptimize(out[0]); });
+        bench::report("complex p, complex x, Complex ops" + deg, ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            q.evaluate(zs.data(), out.data(), N);
+            bench::doNotOptimize(out[0]); });
+        bench::report("complex p, complex x, Horner" + deg, ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            q.evaluate(zs.data(), out.data(), N, myStd::Scheme::Estrin);
+            bench::doNotOptimize(out[0]); });
+        bench::report("complex p, complex x, Estrin" + deg, ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            q.evaluate(myStd::Parallel{}, zs.data(), out.data(), N);
+            bench::doNotOptimize(out[0]); });
+        bench::report("complex p, complex x, Horner parallel" + deg, ns, N);
+    }
+
+    void roots()
+    {
+        std::vector<myStd::Polynomial<double>> polys;
+        for (std::size_t i = 0; i < ROOT_POLYS; ++i)
+        {
+            std::vector<double> c(ROOT_DEGREE + 1);
+            for (auto &v : c)
+                v = dist(rng);
+            polys.emplace_back(c);
+        }
+        std::string deg = " deg " + std::to_string(ROOT_DEGREE);
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            for (const auto &p : polys)
+                bench::doNotOptimize(p.roots());
+        });
+        bench::report("roots one at a time" + deg, ns, ROOT_POLYS);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            bench::doNotOptimize(myStd::findRoots(polys)); });
+        bench::report("findRoots batched" + deg, ns, ROOT_POLYS);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            bench::doNotOptimize(myStd::findRoots(myStd::Parallel{}, polys)); });
+        bench::report("findRoots batched parallel" + deg, ns, ROOT_POLYS);
+    }
+}
+
+int main()
+{
+    for (std::size_t degree : DEGREES)
+        evaluation(degree);
+    roots();
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <memory>
+#include <random>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Reduce.hpp"
+
+/**
+ * @file bench_reduce.cpp
+ * @brief Throughput of the reductions in Reduce.hpp against a naive loop over
+ *        Numeric::operator+=.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native bench/bench_reduce.cpp -o bench_reduce
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 22;
+    constexpr int REPEATS = 5;
+}
+
+int main()
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    std::vector<std::unique_ptr<myStd::Numeric>> polymorphic;
+    std::vector<myStd::Type<double>> types;
+    myStd::NumericVector<double> values, other;
+    myStd::NumericVector<myStd::Complex<double, double>> complexValues;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        double x = dist(rng), y = dist(rng);
+        polymorphic.push_back(std::make_unique<myStd::Type<double>>(x));
+        types.emplace_back(x);
+        values.push_back(x);
+        other.push_back(y);
+        complexValues.push_back({x, y});
+    }
+
+    double ns = bench::bestOfNs(REPEATS, [&]
+                                {
+        myStd::Type<double> acc(0.0);
+        myStd::Numeric &ref = acc;
+        for (auto &p : polymorphic)
+            ref += *p;
+        bench::doNotOptimize(acc); });
+    bench::reportBandwidth("naive Numeric::operator+=", ns, N, N * sizeof(double));
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         { bench::doNotOptimize(myStd::sum(types.data(), N)); });
+    bench::reportBandwidth("sum(Type<double>*)", ns, N, N * sizeof(myStd::Type<double>));
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         { bench::doNotOptimize(myStd::sum(values)); });
+    bench::reportBandwidth("sum(NumericVector<double>) Fast", ns, N, N * sizeof(double));
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         { bench::doNotOptimize(myStd::sum(values, myStd::Summation::Kahan)); });
+    bench::reportBandwidth("sum(NumericVector<double>) Kahan", ns, N, N * sizeof(double));
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         { bench::doNotOptimize(myStd::sum(values, myStd::Summation::Pairwise)); });
+    bench::reportBandwidth("sum(NumericVector<double>) Pairwise", ns, N, N * sizeof(double));
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         { bench::doNotOptimize(myStd::dot(values, other)); });
+    bench::reportBandwidth("dot(NumericVector<double>)", ns, N, 2 * N * sizeof(double));
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         { bench::doNotOptimize(myStd::dot(complexValues, complexValues)); });
+    bench::reportBandwidth("dot(NumericVector<Complex<d,d>>)", ns, N, 4 * N * sizeof(double));
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         { bench::doNotOptimize(myStd::argMax(values)); });
+    bench::reportBandwidth("argMax(NumericVector<double>)", ns, N, N * sizeof(double));
+
+    ns = bench::bestOfNs(REPEATS, [&]
+                         { bench::doNotOptimize(myStd::argMax(complexValues)); });
+    bench::reportBandwidth("argMax(NumericVector<Complex<d,d>>)", ns, N, 2 * N * sizeof(double));
+    return 0;
+}
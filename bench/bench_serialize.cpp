@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Serialize.hpp"
+#include "../inc/Reduce.hpp"
+
+/**
+ * @file bench_serialize.cpp
+ * @brief Storing and loading an array of doubles: text operator<< / operator>>
+ *        against writeArray / readArray, and summing the data through a
+ *        MappedArray without reading it into a buffer first.
+ *
+ * Build: g++ -std=c++17 -O2 bench/bench_serialize.cpp -o bench_serialize
+ * Usage: bench_serialize [elements]
+ */
+
+namespace
+{
+    constexpr int REPEATS = 3;
+    const std::string PATH = "bench_serialize.bin";
+
+    void run(std::size_t n)
+    {
+        std::vector<double> values(n);
+        for (std::size_t i = 0; i < n; ++i)
+            values[i] = static_cast<double>(i) * 0.37;
+        std::size_t bytes = n * sizeof(double);
+
+        std::string text;
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            std::ostringstream os;
+            for (double v : values)
+                os << myStd::Type<double>(v) << '\n';
+            text = os.str(); });
+        bench::reportBandwidth("text write (operator<<)", ns, n, bytes);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            std::istringstream is(text);
+            std::vector<double> back;
+            back.reserve(n);
+            myStd::Type<double> t;
+            while (is >> t)
+                back.push_back(t.get());
+            bench::doNotOptimize(back); });
+        bench::reportBandwidth("text read (operator>>)", ns, n, bytes);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            std::ofstream os(PATH, std::ios::binary);
+            myStd::writeArray(os, values); });
+        bench::reportBandwidth("binary writeArray (file)", ns, n, bytes);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            std::ifstream is(PATH, std::ios::binary);
+            auto back = myStd::readArray<double>(is);
+            bench::doNotOptimize(back); });
+        bench::reportBandwidth("binary readArray (file)", ns, n, bytes);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            std::ifstream is(PATH, std::ios::binary);
+            auto back = myStd::readArray<double>(is);
+            double total = myStd::sum(back.data(), back.size());
+            bench::doNotOptimize(total); });
+        bench::reportBandwidth("readArray + sum", ns, n, bytes);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            myStd::MappedArray<double> view(PATH);
+            double total = myStd::sum(view.data(), view.size());
+            bench::doNotOptimize(total); });
+        bench::reportBandwidth("MappedArray + sum", ns, n, bytes);
+        std::remove(PATH.c_str());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 22;
+    run(n);
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+#include "../inc/Sort.hpp"
+
+/**
+ * @file bench_sort.cpp
+ * @brief Sorting a heterogeneous collection of Numeric pointers: std::sort with
+ *        the virtual operator< against sortByValue at 1 and N threads.
+ *
+ * Build: g++ -std=c++17 -O2 -pthread bench/bench_sort.cpp -o bench_sort
+ * Usage: bench_sort [elements]
+ */
+
+namespace
+{
+    std::vector<std::unique_ptr<myStd::Numeric>> makeMixed(std::size_t n)
+    {
+        std::mt19937 rng(3);
+        std::uniform_int_distribution<int> kind(0, 3);
+        std::uniform_int_distribution<int> num(-1000, 1000);
+        std::vector<std::unique_ptr<myStd::Numeric>> v;
+        v.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            int a = num(rng), b = num(rng);
+            switch (kind(rng))
+            {
+            case 0:
+                v.push_back(std::make_unique<myStd::Type<int>>(a));
+                break;
+            case 1:
+                v.push_back(std::make_unique<myStd::Type<double>>(a * 0.25));
+                break;
+            case 2:
+                v.push_back(std::make_unique<myStd::Type<myStd::Complex<int, int>>>(myStd::Complex<int, int>(a, b)));
+                break;
+            default:
+                v.push_back(std::make_unique<myStd::Type<myStd::Complex<double, double>>>(myStd::Complex<double, double>(a, b)));
+                break;
+            }
+        }
+        return v;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1} << 21;
+    unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+
+    // Every case sorts the same objects from the same initial order
+    auto owned = makeMixed(n);
+    std::vector<myStd::Numeric *> original;
+    for (auto &p : owned)
+        original.push_back(p.get());
+
+    auto v = original;
+    double ns = bench::timeNs([&]
+                              { std::sort(v.begin(), v.end(), [](const auto &a, const auto &b)
+                                          { return *a < *b; }); });
+    bench::report("std::sort(*a < *b)", ns, n);
+
+    v = original;
+    ns = bench::timeNs([&]
+                       { myStd::sortByValue(v, 1); });
+    bench::report("sortByValue, 1 thread", ns, n);
+
+    v = original;
+    ns = bench::timeNs([&]
+                       { myStd::sortByValue(v, hw); });
+    bench::report("sortByValue, " + std::to_string(hw) + " threads", ns, n);
+    return 0;
+}
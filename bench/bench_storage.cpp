@@ -0,0 +1,55 @@
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+
+/**
+ * @file bench_storage.cpp
+ * @brief Construction, copy and operator+ throughput of Type<T>.
+ *
+ * Build: g++ -std=c++17 -O2 bench/bench_storage.cpp -o bench_storage
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 20;
+    constexpr int REPEATS = 5;
+
+    template <typename T>
+    void run(const std::string &name, T seed)
+    {
+        std::vector<myStd::Type<T>> src;
+        src.reserve(N);
+
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            src.clear();
+            for (std::size_t i = 0; i < N; ++i)
+                src.emplace_back(seed); });
+        bench::report(name + " construct", ns, N);
+
+        std::vector<myStd::Type<T>> dst(N);
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i < N; ++i)
+                dst[i] = src[i];
+            bench::doNotOptimize(dst); });
+        bench::report(name + " copy", ns, N);
+
+        ns = bench::bestOfNs(REPEATS, [&]
+                             {
+            for (std::size_t i = 0; i + 1 < N; ++i)
+            {
+                auto r = src[i] + src[i + 1];
+                bench::doNotOptimize(r);
+            } });
+        bench::report(name + " operator+", ns, N - 1);
+    }
+}
+
+int main()
+{
+    run<int>("Type<int>", 7);
+    run<double>("Type<double>", 1.5);
+    run<myStd::Complex<double, double>>("Type<Complex<double,double>>", {1.0, 2.0});
+    return 0;
+}
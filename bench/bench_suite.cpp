@@ -0,0 +1,327 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "Suite.hpp"
+#include "../inc/Type.hpp"
+#include "../inc/Sort.hpp"
+
+/**
+ * @file bench_suite.cpp
+ * @brief Regression suite over the public operators: Type<T> construction,
+ *        copy and move, same- and mixed-type arithmetic and comparisons through
+ *        Numeric&, every Complex<T, U> operator, getValue() and the
+ *        heterogeneous sort, each at sizes from L1-resident to DRAM-bound.
+ *
+ * Build: g++ -std=c++17 -O2 -pthread bench/bench_suite.cpp -o bench_suite
+ * Usage: bench_suite [--format=console|json|csv] [--out=FILE] [--filter=TEXT] [--sizes=N,N,...]
+ */
+
+namespace
+{
+    using myStd::Complex;
+    using myStd::Numeric;
+    using myStd::Type;
+    using Ptrs = std::vector<std::unique_ptr<Numeric>>;
+
+    template <typename T>
+    std::string typeName()
+    {
+        if constexpr (std::is_same_v<T, int>)
+            return "int";
+        else if constexpr (std::is_same_v<T, double>)
+            return "double";
+        else
+            return "Complex<" + typeName<decltype(T().getReal())>() + "," + typeName<decltype(T().getImg())>() + ">";
+    }
+
+    /// Non-zero values, so division is defined; seed varies the operands.
+    template <typename T>
+    T valueAt(std::size_t i, int seed)
+    {
+        int v = static_cast<int>(i % 97) + seed;
+        if constexpr (is_complex<T>::value)
+            return T(v, seed);
+        else
+            return static_cast<T>(v);
+    }
+
+    template <typename T>
+    T unit()
+    {
+        if constexpr (is_complex<T>::value)
+            return T(1, 0);
+        else
+            return T(1);
+    }
+
+    template <typename T>
+    Ptrs makeNumeric(std::size_t n, int seed)
+    {
+        Ptrs v;
+        v.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+            v.push_back(std::make_unique<Type<T>>(valueAt<T>(i, seed)));
+        return v;
+    }
+
+    Ptrs makeMixed(std::size_t n)
+    {
+        std::mt19937 rng(3);
+        std::uniform_int_distribution<int> kind(0, 3);
+        std::uniform_int_distribution<int> num(-1000, 1000);
+        Ptrs v;
+        v.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            int a = num(rng), b = num(rng);
+            switch (kind(rng))
+            {
+            case 0:
+                v.push_back(std::make_unique<Type<int>>(a));
+                break;
+            case 1:
+                v.push_back(std::make_unique<Type<double>>(a * 0.25));
+                break;
+            case 2:
+                v.push_back(std::make_unique<Type<Complex<int, int>>>(Complex<int, int>(a, b)));
+                break;
+            default:
+                v.push_back(std::make_unique<Type<Complex<double, double>>>(Complex<double, double>(a * 0.5, b * 0.5)));
+                break;
+            }
+        }
+        return v;
+    }
+
+    // =========================
+    // Type<T>
+    // =========================
+
+    template <typename T>
+    void lifetime(bench::Suite &suite)
+    {
+        suite.add("Type<" + typeName<T>() + "> construct+destroy", [](bench::State &state)
+                  {
+            std::size_t n = state.size();
+            state.measure([&]
+                          {
+                Ptrs v;
+                v.reserve(n);
+                for (std::size_t i = 0; i < n; ++i)
+                    v.push_back(std::make_unique<Type<T>>(valueAt<T>(i, 1)));
+                bench::doNotOptimize(v); }); });
+
+        suite.add("Type<" + typeName<T>() + "> copy assign", [](bench::State &state)
+                  {
+            std::vector<Type<T>> src(state.size(), Type<T>(valueAt<T>(0, 1))), dst(state.size());
+            state.setBytesPerItem(2.0 * sizeof(Type<T>));
+            state.measure([&]
+                          {
+                for (std::size_t i = 0; i < src.size(); ++i)
+                    dst[i] = src[i];
+                bench::doNotOptimize(dst); }); });
+
+        suite.add("Type<" + typeName<T>() + "> move assign", [](bench::State &state)
+                  {
+            std::vector<Type<T>> a(state.size(), Type<T>(valueAt<T>(0, 1))), b(state.size());
+            state.setBytesPerItem(2.0 * sizeof(Type<T>));
+            state.measure([&]
+                          {
+                for (std::size_t i = 0; i < a.size(); ++i)
+                    b[i] = std::move(a[i]);
+                a.swap(b);
+                bench::doNotOptimize(a); }); });
+    }
+
+    /// op(Type<L>&, Numeric&) returning std::unique_ptr<Numeric>.
+    template <typename L, typename R, typename Op>
+    void arithmetic(bench::Suite &suite, const std::string &symbol, Op op)
+    {
+        suite.add("Type<" + typeName<L>() + "> " + symbol + " Type<" + typeName<R>() + ">", [op](bench::State &state)
+                  {
+            Ptrs a = makeNumeric<L>(state.size(), 1), b = makeNumeric<R>(state.size(), 2), out(state.size());
+            state.measure([&]
+                          {
+                for (std::size_t i = 0; i < a.size(); ++i)
+                    out[i] = op(static_cast<Type<L> &>(*a[i]), *b[i]);
+                bench::doNotOptimize(out); }); });
+    }
+
+    /// op(Numeric&, Numeric&) returning bool or modifying the left operand in place.
+    template <typename L, typename R, typename Op>
+    void inPlace(bench::Suite &suite, const std::string &symbol, Op op)
+    {
+        suite.add("Type<" + typeName<L>() + "> " + symbol + " Type<" + typeName<R>() + ">", [op](bench::State &state)
+                  {
+            // Right operands of 1 keep repeated compound assignments in range
+            Ptrs a = makeNumeric<L>(state.size(), 1), b = makeNumeric<R>(state.size(), 2);
+            for (auto &p : b)
+                static_cast<Type<R> &>(*p) = Type<R>(unit<R>());
+            std::size_t count = 0;
+            state.measure([&]
+                          {
+                for (std::size_t i = 0; i < a.size(); ++i)
+                    count += static_cast<std::size_t>(op(*a[i], *b[i]));
+                bench::doNotOptimize(count); }); });
+    }
+
+    template <typename L, typename R>
+    void typeOperators(bench::Suite &suite)
+    {
+        arithmetic<L, R>(suite, "+", [](Type<L> &a, Numeric &b)
+                         { return a + b; });
+        arithmetic<L, R>(suite, "-", [](Type<L> &a, Numeric &b)
+                         { return a - b; });
+        if constexpr (!is_complex<L>::value && !is_complex<R>::value)
+        {
+            arithmetic<L, R>(suite, "*", [](Type<L> &a, Numeric &b)
+                             { return a * b; });
+            arithmetic<L, R>(suite, "/", [](Type<L> &a, Numeric &b)
+                             { return a / b; });
+        }
+        inPlace<L, R>(suite, "+=", [](Numeric &a, Numeric &b)
+                      { a += b; return true; });
+        inPlace<L, R>(suite, "-=", [](Numeric &a, Numeric &b)
+                      { a -= b; return true; });
+        inPlace<L, R>(suite, "*=", [](Numeric &a, Numeric &b)
+                      { a *= b; return true; });
+        inPlace<L, R>(suite, "/=", [](Numeric &a, Numeric &b)
+                      { a /= b; return true; });
+        inPlace<L, R>(suite, "<", [](Numeric &a, Numeric &b)
+                      { return a < b; });
+        // > and == are only defined between operands of the same type
+        if constexpr (std::is_same_v<L, R>)
+        {
+            inPlace<L, R>(suite, ">", [](Numeric &a, Numeric &b)
+                          { return a > b; });
+            inPlace<L, R>(suite, "==", [](Numeric &a, Numeric &b)
+                          { return a == b; });
+        }
+    }
+
+    void getValue(bench::Suite &suite)
+    {
+        suite.add("Numeric::getValue() mixed", [](bench::State &state)
+                  {
+            Ptrs v = makeMixed(state.size());
+            state.measure([&]
+                          {
+                double total = 0;
+                for (auto &p : v)
+                    total += p->getValue();
+                bench::doNotOptimize(total); }); });
+    }
+
+    // =========================
+    // Complex<T, U>
+    // =========================
+
+    template <typename C, typename Op>
+    void complexBinary(bench::Suite &suite, const std::string &symbol, Op op)
+    {
+        suite.add(typeName<C>() + " " + symbol, [op](bench::State &state)
+                  {
+            std::vector<C> a(state.size()), b(state.size());
+            for (std::size_t i = 0; i < a.size(); ++i)
+            {
+                a[i] = valueAt<C>(i, 1);
+                b[i] = valueAt<C>(i, 2);
+            }
+            using Out = decltype(op(a[0], b[0]));
+            std::vector<Out> out(state.size());
+            state.setBytesPerItem(2.0 * sizeof(C) + sizeof(Out));
+            state.measure([&]
+                          {
+                for (std::size_t i = 0; i < a.size(); ++i)
+                    out[i] = op(a[i], b[i]);
+                bench::doNotOptimize(out); }); });
+    }
+
+    template <typename C>
+    void complexOperators(bench::Suite &suite)
+    {
+        complexBinary<C>(suite, "+", [](const C &a, const C &b)
+                         { return a + b; });
+        complexBinary<C>(suite, "-", [](const C &a, const C &b)
+                         { return a - b; });
+        complexBinary<C>(suite, "*", [](const C &a, const C &b)
+                         { return a * b; });
+        complexBinary<C>(suite, "/", [](const C &a, const C &b)
+                         { return a / b; });
+        complexBinary<C>(suite, "+=", [](C a, const C &b)
+                         { return a += b; });
+        complexBinary<C>(suite, "-=", [](C a, const C &b)
+                         { return a -= b; });
+        complexBinary<C>(suite, "*=", [](C a, const C &b)
+                         { return a *= b; });
+        complexBinary<C>(suite, "/=", [](C a, const C &b)
+                         { return a /= b; });
+        complexBinary<C>(suite, "<", [](const C &a, const C &b)
+                         { return static_cast<char>(a < b); });
+        complexBinary<C>(suite, ">", [](const C &a, const C &b)
+                         { return static_cast<char>(a > b); });
+        complexBinary<C>(suite, "==", [](const C &a, const C &b)
+                         { return static_cast<char>(a == b); });
+        complexBinary<C>(suite, "getValue()", [](const C &a, const C &)
+                         { return a.getValue(); });
+        complexBinary<C>(suite, "norm()", [](const C &a, const C &)
+                         { return a.norm(); });
+    }
+
+    // =========================
+    // Sort
+    // =========================
+
+    template <typename Sort>
+    void sortCase(bench::Suite &suite, const std::string &name, Sort sort)
+    {
+        // Each call copies the unsorted pointers back first; that copy is part of the time
+        suite.add(name, [sort](bench::State &state)
+                  {
+            Ptrs owner = makeMixed(state.size());
+            std::vector<Numeric *> original, v;
+            for (auto &p : owner)
+                original.push_back(p.get());
+            state.measure([&]
+                          {
+                v = original;
+                sort(v);
+                bench::doNotOptimize(v); }); },
+                  1 << 20);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bench::Suite suite;
+
+    lifetime<int>(suite);
+    lifetime<double>(suite);
+    lifetime<Complex<double, double>>(suite);
+
+    typeOperators<int, int>(suite);
+    typeOperators<double, double>(suite);
+    typeOperators<Complex<int, int>, Complex<int, int>>(suite);
+    typeOperators<Complex<double, double>, Complex<double, double>>(suite);
+    typeOperators<int, double>(suite);
+    typeOperators<double, int>(suite);
+    typeOperators<int, Complex<double, double>>(suite);
+    typeOperators<Complex<int, int>, double>(suite);
+    typeOperators<Complex<int, double>, Complex<double, int>>(suite);
+    getValue(suite);
+
+    complexOperators<Complex<int, int>>(suite);
+    complexOperators<Complex<double, double>>(suite);
+    complexOperators<Complex<int, double>>(suite);
+    complexOperators<Complex<double, int>>(suite);
+
+    sortCase(suite, "std::sort(Numeric*, operator<) mixed", [](std::vector<Numeric *> &v)
+             { std::sort(v.begin(), v.end(), [](Numeric *a, Numeric *b)
+                         { return *a < *b; }); });
+    sortCase(suite, "sortByValue(Numeric*) mixed", [](std::vector<Numeric *> &v)
+             { myStd::sortByValue(v); });
+
+    return suite.run(argc, argv);
+}
@@ -0,0 +1,69 @@
+#include <memory>
+#include <vector>
+#include "Bench.hpp"
+#include "../inc/Type.hpp"
+#include "../inc/NumericVector.hpp"
+
+/**
+ * @file bench_vector.cpp
+ * @brief Element-wise throughput of NumericVector<T> against a
+ *        std::vector<std::unique_ptr<Numeric>> of the same values.
+ *
+ * Build: g++ -std=c++17 -O3 -march=native bench/bench_vector.cpp -o bench_vector
+ */
+
+namespace
+{
+    constexpr std::size_t N = 1 << 22;
+    constexpr int REPEATS = 5;
+
+    void polymorphic()
+    {
+        std::vector<std::unique_ptr<myStd::Numeric>> a, b, out(N);
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            a.push_back(std::make_unique<myStd::Type<double>>(static_cast<double>(i)));
+            b.push_back(std::make_unique<myStd::Type<double>>(0.5));
+        }
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    {
+            for (std::size_t i = 0; i < N; ++i)
+                out[i] = *a[i] + *b[i];
+            bench::doNotOptimize(out); });
+        bench::reportBandwidth("unique_ptr<Numeric> double +", ns, N, 3 * N * sizeof(double));
+    }
+
+    template <typename T>
+    void contiguous(const std::string &name, T x, T y)
+    {
+        myStd::NumericVector<T> a(N, x), b(N, y), out;
+        double ns = bench::bestOfNs(REPEATS, [&]
+                                    { out = a + b; bench::doNotOptimize(out); });
+        bench::reportBandwidth(name + " +", ns, N, 3 * N * sizeof(T));
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { out = a * b; bench::doNotOptimize(out); });
+        bench::reportBandwidth(name + " *", ns, N, 3 * N * sizeof(T));
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { out = a / b; bench::doNotOptimize(out); });
+        bench::reportBandwidth(name + " /", ns, N, 3 * N * sizeof(T));
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { a += b; bench::doNotOptimize(a); });
+        bench::reportBandwidth(name + " += vector", ns, N, 3 * N * sizeof(T));
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { a += y; bench::doNotOptimize(a); });
+        bench::reportBandwidth(name + " += scalar", ns, N, 2 * N * sizeof(T));
+        auto mags = a.getValue();
+        ns = bench::bestOfNs(REPEATS, [&]
+                             { mags = a.getValue(); bench::doNotOptimize(mags); });
+        bench::reportBandwidth(name + " getValue()", ns, N, N * sizeof(T) + N * sizeof(mags[0]));
+    }
+}
+
+int main()
+{
+    polymorphic();
+    contiguous<int>("NumericVector<int>", 7, 3);
+    contiguous<double>("NumericVector<double>", 1.5, 0.5);
+    contiguous<myStd::Complex<double, double>>("NumericVector<Complex<double,double>>", {1.0, 2.0}, {0.5, -1.0});
+    return 0;
+}
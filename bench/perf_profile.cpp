@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "PerfCounters.hpp"
+#include "../inc/Type.hpp"
+#include "../inc/Sort.hpp"
+#include "../inc/NumericVector.hpp"
+
+/**
+ * @file perf_profile.cpp
+ * @brief Hardware counters per element for the library's operators: cycles,
+ *        instructions, branch misses, L1d and LLC misses, plus heap allocations
+ *        (all of them, and Numeric results alone).
+ *
+ * Counters the host does not expose are printed as "n/a"; times and
+ * allocation counts are always reported.
+ *
+ * Build: g++ -std=c++17 -O2 -pthread bench/perf_profile.cpp -o perf_profile
+ * Usage: perf_profile [elements] [filter]
+ */
+
+namespace
+{
+    std::atomic<std::size_t> newCalls{0};
+}
+
+// Count every global allocation made while a case runs
+void *operator new(std::size_t size)
+{
+    newCalls.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return ::operator new(size); }
+
+// Kept out of line: inlined, GCC sees free() on a pointer from operator new and warns
+[[gnu::noinline]] void operator delete(void *p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete[](void *p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+    using myStd::Complex;
+    using myStd::Numeric;
+    using myStd::Type;
+    using Ptrs = std::vector<std::unique_ptr<Numeric>>;
+
+    std::size_t N = 1 << 18;
+    std::string filter;
+
+    template <typename T>
+    Ptrs makeNumeric(std::size_t n, int seed)
+    {
+        Ptrs v;
+        v.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            int x = static_cast<int>(i % 97) + seed;
+            if constexpr (is_complex<T>::value)
+                v.push_back(std::make_unique<Type<T>>(T(x, seed)));
+            else
+                v.push_back(std::make_unique<Type<T>>(static_cast<T>(x)));
+        }
+        return v;
+    }
+
+    /// Random mix of int, double and complex values, shuffled so branches are unpredictable.
+    Ptrs makeMixed(std::size_t n)
+    {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> kind(0, 3);
+        std::uniform_int_distribution<int> num(-1000, 1000);
+        Ptrs v;
+        v.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            int a = num(rng), b = num(rng);
+            switch (kind(rng))
+            {
+            case 0:
+                v.push_back(std::make_unique<Type<int>>(a));
+                break;
+            case 1:
+                v.push_back(std::make_unique<Type<double>>(a * 0.25));
+                break;
+            case 2:
+                v.push_back(std::make_unique<Type<Complex<int, int>>>(Complex<int, int>(a, b)));
+                break;
+            default:
+                v.push_back(std::make_unique<Type<Complex<double, double>>>(Complex<double, double>(a * 0.5, b * 0.5)));
+                break;
+            }
+        }
+        return v;
+    }
+
+    void header(bench::PerfCounters &pmu)
+    {
+        if (!pmu.available())
+            std::cout << "Hardware counters unavailable: " << pmu.unavailableReason() << "\n";
+        else if (!pmu.unavailableReason().empty())
+            std::cout << "Some hardware counters unavailable: " << pmu.unavailableReason() << "\n";
+        std::cout << "Per element, " << N << " elements\n"
+                  << std::left << std::setw(40) << "case" << std::right << std::setw(9) << "ns";
+        for (int c = 0; c < bench::CounterSample::N; ++c)
+            std::cout << std::setw(10) << bench::counterName(static_cast<bench::Counter>(c));
+        std::cout << std::setw(8) << "IPC" << std::setw(9) << "allocs" << std::setw(9) << "Numeric" << "\n";
+    }
+
+    /**
+     * @brief Runs fn once to warm up, then once under the counters, and prints one row.
+     */
+    template <typename F>
+    void profile(bench::PerfCounters &pmu, const std::string &name, F &&fn)
+    {
+        if (name.find(filter) == std::string::npos)
+            return;
+        fn();
+        myStd::resetAllocStats();
+        std::size_t news = newCalls.load();
+        bench::CounterSample s;
+        double ns = bench::timeNs([&]
+                                  { s = pmu.measure(fn); });
+        news = newCalls.load() - news;
+        double n = static_cast<double>(N);
+
+        std::cout << std::left << std::setw(40) << name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(9) << ns / n;
+        for (int c = 0; c < bench::CounterSample::N; ++c)
+        {
+            auto counter = static_cast<bench::Counter>(c);
+            if (s.has(counter))
+                std::cout << std::setw(10) << s[counter] / n;
+            else
+                std::cout << std::setw(10) << "n/a";
+        }
+        if (s.has(bench::Counter::Cycles) && s.has(bench::Counter::Instructions))
+            std::cout << std::setw(8) << s[bench::Counter::Instructions] / s[bench::Counter::Cycles];
+        else
+            std::cout << std::setw(8) << "n/a";
+        std::cout << std::setw(9) << static_cast<double>(news) / n
+                  << std::setw(9) << static_cast<double>(myStd::allocStats().heap) / n << std::endl;
+    }
+
+    template <typename L, typename R>
+    void binary(bench::PerfCounters &pmu, const std::string &name)
+    {
+        Ptrs a = makeNumeric<L>(N, 1), b = makeNumeric<R>(N, 2), out(N);
+        profile(pmu, name + " +", [&]
+                {
+            for (std::size_t i = 0; i < N; ++i)
+                out[i] = *a[i] + *b[i];
+            bench::doNotOptimize(out); });
+        profile(pmu, name + " <", [&]
+                {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < N; ++i)
+                count += *a[i] < *b[i];
+            bench::doNotOptimize(count); });
+        profile(pmu, name + " +=", [&]
+                {
+            for (std::size_t i = 0; i < N; ++i)
+                *a[i] += *b[i];
+            bench::doNotOptimize(a); });
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+        N = std::strtoull(argv[1], nullptr, 10);
+    if (argc > 2)
+        filter = argv[2];
+
+    bench::PerfCounters pmu;
+    header(pmu);
+
+    profile(pmu, "Type<double> construct+destroy", []
+            {
+        Ptrs v;
+        v.reserve(N);
+        for (std::size_t i = 0; i < N; ++i)
+            v.push_back(std::make_unique<Type<double>>(1.5));
+        bench::doNotOptimize(v); });
+
+    binary<int, int>(pmu, "int op int");
+    binary<double, double>(pmu, "double op double");
+    binary<int, double>(pmu, "int op double");
+    binary<Complex<double, double>, int>(pmu, "Complex<double,double> op int");
+    binary<double, Complex<int, int>>(pmu, "double op Complex<int,int>");
+
+    {
+        Ptrs a = makeMixed(N), b = makeMixed(N), out(N);
+        std::shuffle(b.begin(), b.end(), std::mt19937(11));
+        profile(pmu, "mixed + mixed", [&]
+                {
+            for (std::size_t i = 0; i < N; ++i)
+                out[i] = *a[i] + *b[i];
+            bench::doNotOptimize(out); });
+        profile(pmu, "mixed < mixed", [&]
+                {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < N; ++i)
+                count += *a[i] < *b[i];
+            bench::doNotOptimize(count); });
+        profile(pmu, "mixed getValue()", [&]
+                {
+            double total = 0;
+            for (auto &p : a)
+                total += p->getValue();
+            bench::doNotOptimize(total); });
+
+        std::vector<Numeric *> original, v;
+        for (auto &p : a)
+            original.push_back(p.get());
+        profile(pmu, "std::sort mixed (operator<)", [&]
+                {
+            v = original;
+            std::sort(v.begin(), v.end(), [](Numeric *x, Numeric *y)
+                      { return *x < *y; });
+            bench::doNotOptimize(v); });
+        profile(pmu, "sortByValue mixed", [&]
+                {
+            v = original;
+            myStd::sortByValue(v);
+            bench::doNotOptimize(v); });
+    }
+
+    {
+        myStd::NumericVector<double> x(N, 1.5), y(N, 0.5), z(N);
+        profile(pmu, "NumericVector<double> +", [&]
+                { z = x + y; bench::doNotOptimize(z); });
+        myStd::NumericVector<Complex<double, double>> c(N, {3, 4}), d(N, {1, -2}), e(N);
+        profile(pmu, "NumericVector<Complex<double,double>> *", [&]
+                { e = c * d; bench::doNotOptimize(e); });
+    }
+    return 0;
+}
@@ -0,0 +1,205 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+/**
+ * @file Arena.hpp
+ * @brief Arena allocation for the polymorphic results of Numeric operators.
+ *
+ * Every Numeric is allocated through Numeric::operator new, which takes memory
+ * from the arena of the innermost ArenaScope on the calling thread, or from the
+ * global heap when no scope is active:
+ *
+ * @code
+ * NumericArena arena;
+ * for (auto &batch : batches)
+ * {
+ *     ArenaScope scope(arena);
+ *     auto r = *a + *b; // no call into malloc
+ *     ...
+ *     // r destroyed here
+ *     arena.release();
+ * }
+ * @endcode
+ *
+ * Objects taken from an arena must be destroyed before the arena is released
+ * or destroyed. Destroying them returns nothing to the arena; the memory is
+ * reclaimed in bulk by release(). An arena must only be used by one thread at
+ * a time.
+ */
+
+namespace myStd
+{
+    /**
+     * @brief Snapshot of Numeric allocation counters.
+     */
+    struct AllocStats
+    {
+        std::size_t heap;  ///< Numerics allocated from the global heap
+        std::size_t arena; ///< Numerics allocated from an arena
+    };
+
+    namespace detail
+    {
+        /// Counters behind allocStats(), shared by all threads.
+        inline std::atomic<std::size_t> heapAllocations{0};
+        inline std::atomic<std::size_t> arenaAllocations{0};
+
+        /// Memory resource of the innermost ArenaScope on this thread, nullptr for the heap.
+        inline thread_local std::pmr::memory_resource *currentResource = nullptr;
+
+        /**
+         * @brief Header placed in front of every Numeric so delete knows where it came from.
+         */
+        struct alignas(std::max_align_t) AllocHeader
+        {
+            std::pmr::memory_resource *resource; ///< Owning resource, nullptr for the heap
+            std::size_t bytes;                   ///< Total size including this header
+        };
+
+        /// Bytes from the start of a block to the object, for an object aligned to align.
+        constexpr std::size_t headerSpace(std::size_t align) noexcept
+        {
+            return align > sizeof(AllocHeader) ? align : sizeof(AllocHeader);
+        }
+
+        /**
+         * @brief Allocates size bytes for a Numeric from the current arena or the heap.
+         * @param align Alignment of the object; above alignof(std::max_align_t) for over-aligned types.
+         */
+        inline void *allocateNumeric(std::size_t size, std::size_t align = alignof(std::max_align_t))
+        {
+            std::size_t offset = headerSpace(align), bytes = size + offset;
+            std::pmr::memory_resource *resource = currentResource;
+            void *block;
+            if (resource)
+            {
+                block = resource->allocate(bytes, align);
+                arenaAllocations.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                block = align > alignof(std::max_align_t) ? ::operator new(bytes, std::align_val_t(align)) : ::operator new(bytes);
+                heapAllocations.fetch_add(1, std::memory_order_relaxed);
+            }
+            char *object = static_cast<char *>(block) + offset;
+            ::new (object - sizeof(AllocHeader)) AllocHeader{resource, bytes};
+            return object;
+        }
+
+        /**
+         * @brief Returns memory obtained from allocateNumeric, with the same align, to its origin.
+         */
+        inline void deallocateNumeric(void *p, std::size_t align = alignof(std::max_align_t)) noexcept
+        {
+            if (!p)
+                return;
+            auto *header = static_cast<AllocHeader *>(p) - 1;
+            void *block = static_cast<char *>(p) - headerSpace(align);
+            if (header->resource)
+                header->resource->deallocate(block, header->bytes, align);
+            else if (align > alignof(std::max_align_t))
+                ::operator delete(block, std::align_val_t(align));
+            else
+                ::operator delete(block);
+        }
+    }
+
+    /**
+     * @brief Returns the number of Numeric allocations so far, split by origin.
+     */
+    inline AllocStats allocStats()
+    {
+        return {detail::heapAllocations.load(std::memory_order_relaxed),
+                detail::arenaAllocations.load(std::memory_order_relaxed)};
+    }
+
+    /**
+     * @brief Resets the Numeric allocation counters to zero.
+     */
+    inline void resetAllocStats()
+    {
+        detail::heapAllocations.store(0, std::memory_order_relaxed);
+        detail::arenaAllocations.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Monotonic arena for Numeric results.
+     *
+     * The initial buffer is allocated once, when the arena is constructed; only
+     * batches that outgrow it fall back to the upstream resource.
+     */
+    class NumericArena
+    {
+    private:
+        std::unique_ptr<std::byte[]> buffer;
+        std::pmr::monotonic_buffer_resource pool;
+
+    public:
+        /**
+         * @brief Construct an arena.
+         * @param initialBytes Size of the buffer allocated up front.
+         * @param upstream Resource used once the buffer is exhausted.
+         */
+        explicit NumericArena(std::size_t initialBytes = 1 << 20,
+                              std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+            : buffer(new std::byte[initialBytes]), pool(buffer.get(), initialBytes, upstream) {}
+
+        NumericArena(const NumericArena &) = delete;
+        NumericArena &operator=(const NumericArena &) = delete;
+
+        /**
+         * @brief Reclaims all memory handed out so far. Objects from this arena must already be destroyed.
+         */
+        void release()
+        {
+            pool.release();
+        }
+
+        /**
+         * @brief Returns the underlying memory resource.
+         */
+        std::pmr::memory_resource *resource()
+        {
+            return &pool;
+        }
+    };
+
+    /**
+     * @brief RAII scope that makes Numeric allocations on this thread use an arena.
+     *
+     * Scopes nest; the previous arena (or the heap) is restored on destruction.
+     */
+    class ArenaScope
+    {
+    private:
+        std::pmr::memory_resource *previous;
+
+    public:
+        /**
+         * @brief Routes Numeric allocations to an arena.
+         * @param arena Arena to allocate from.
+         */
+        explicit ArenaScope(NumericArena &arena) : ArenaScope(arena.resource()) {}
+
+        /**
+         * @brief Routes Numeric allocations to any memory resource.
+         * @param resource Resource to allocate from.
+         */
+        explicit ArenaScope(std::pmr::memory_resource *resource) : previous(detail::currentResource)
+        {
+            detail::currentResource = resource;
+        }
+
+        ~ArenaScope()
+        {
+            detail::currentResource = previous;
+        }
+
+        ArenaScope(const ArenaScope &) = delete;
+        ArenaScope &operator=(const ArenaScope &) = delete;
+    };
+}
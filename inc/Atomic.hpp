@@ -0,0 +1,271 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "Type.hpp"
+
+/**
+ * @file Atomic.hpp
+ * @brief Lock-free accumulators that many threads can update at once.
+ *
+ * AtomicType<T> is a single atomic int or double: every update is one
+ * fetch_add (integers) or compare-exchange loop (floating point) on one cache
+ * line, which is the cheapest option while few threads write.
+ *
+ * StripedAccumulator<T> spreads updates over several cache lines ("stripes"),
+ * one per group of threads, so writers on different cores do not fight over
+ * the same line; reading sums the stripes. It also handles Complex values,
+ * whose two parts can't be updated with a single atomic instruction.
+ *
+ * @code
+ * StripedAccumulator<Complex<double, double>> total;
+ * pool.parallelFor(n, 4096, [&](std::size_t b, std::size_t e) {
+ *     for (std::size_t i = b; i < e; ++i)
+ *         total += samples[i];
+ * });
+ * Complex<double, double> s = total.load();
+ * @endcode
+ */
+
+namespace myStd
+{
+    namespace detail
+    {
+        /// Adds x to a and returns the new value; compare-exchange for floating point before C++20.
+        template <typename F>
+        F atomicAdd(std::atomic<F> &a, F x, std::memory_order order = std::memory_order_seq_cst) noexcept
+        {
+            if constexpr (std::is_integral_v<F>)
+                return a.fetch_add(x, order) + x;
+            else
+            {
+                F old = a.load(std::memory_order_relaxed);
+                while (!a.compare_exchange_weak(old, old + x, order, std::memory_order_relaxed))
+                {
+                }
+                return old + x;
+            }
+        }
+
+        /// Real and imaginary part types of an accumulator value; arithmetic values have no imaginary part.
+        template <typename T>
+        struct AccumulatorParts
+        {
+            using Re = T;
+            using Im = T;
+            static constexpr bool complex = false;
+        };
+
+        template <typename T, typename U>
+        struct AccumulatorParts<Complex<T, U>>
+        {
+            using Re = T;
+            using Im = U;
+            static constexpr bool complex = true;
+        };
+
+        /// Small per-thread number used to pick a stripe; consecutive threads get consecutive numbers.
+        inline std::size_t threadStripe() noexcept
+        {
+            static std::atomic<std::size_t> next{0};
+            thread_local std::size_t id = next.fetch_add(1, std::memory_order_relaxed);
+            return id;
+        }
+    }
+
+    /**
+     * @brief Lock-free atomic int or double with Type<T>-style compound operators.
+     *
+     * Unlike Type<T>, the compound operators may be called from any number of
+     * threads at once; they return the new value, like std::atomic, rather than
+     * a reference, since the object may already have changed again.
+     *
+     * @tparam T int, double or another arithmetic type.
+     */
+    template <typename T>
+    class AtomicType
+    {
+        static_assert(std::is_arithmetic_v<T>, "AtomicType holds int, double or another arithmetic type");
+
+    private:
+        std::atomic<T> val;
+
+    public:
+        AtomicType(T value = T{}) noexcept : val(value) {}
+        explicit AtomicType(const Type<T> &value) noexcept : val(value.get()) {}
+
+        AtomicType(const AtomicType &) = delete;
+        AtomicType &operator=(const AtomicType &) = delete;
+
+        /// Current value.
+        T load(std::memory_order order = std::memory_order_seq_cst) const noexcept { return val.load(order); }
+
+        /// Current value as a Type<T>.
+        Type<T> get() const { return Type<T>(load()); }
+
+        operator T() const noexcept { return load(); }
+
+        void store(T value, std::memory_order order = std::memory_order_seq_cst) noexcept { val.store(value, order); }
+
+        /// Replaces the value and returns the previous one, e.g. to drain a counter.
+        T exchange(T value, std::memory_order order = std::memory_order_seq_cst) noexcept { return val.exchange(value, order); }
+
+        /**
+         * @brief Applies f to the value atomically and returns the new value.
+         * @param f Callable T(T); may run more than once under contention, so it must not have side effects.
+         */
+        template <typename F>
+        T update(F f) noexcept
+        {
+            T old = val.load(std::memory_order_relaxed);
+            T next = f(old);
+            while (!val.compare_exchange_weak(old, next, std::memory_order_seq_cst, std::memory_order_relaxed))
+                next = f(old);
+            return next;
+        }
+
+        T operator+=(T x) noexcept { return detail::atomicAdd(val, x); }
+        T operator-=(T x) noexcept { return detail::atomicAdd(val, static_cast<T>(-x)); }
+        T operator*=(T x) noexcept
+        {
+            return update([x](T v)
+                          { return v * x; });
+        }
+        T operator/=(T x) noexcept
+        {
+            return update([x](T v)
+                          { return v / x; });
+        }
+
+        T operator+=(const Type<T> &x) noexcept { return *this += x.get(); }
+        T operator-=(const Type<T> &x) noexcept { return *this -= x.get(); }
+    };
+
+    /**
+     * @brief Sum that many threads add to without locks, for arithmetic and Complex values.
+     *
+     * Each thread adds to one of Stripes cache lines, chosen by the order in which
+     * threads first touch any accumulator; with at least as many stripes as
+     * writing threads they never contend. Adding is lock-free.
+     *
+     * load() is consistent per value: each += is seen with both its real and
+     * imaginary part or not at all, never half-applied. It is not one point in
+     * time across all threads while they are still adding; once the writers are
+     * done (e.g. joined, or a parallelFor returned) it is the exact total of every
+     * += made, up to floating-point rounding order.
+     *
+     * @tparam T int, double, or Complex<T, U>.
+     * @tparam Stripes Number of cache lines to spread writers over.
+     */
+    template <typename T, std::size_t Stripes = 64>
+    class StripedAccumulator
+    {
+        static_assert(Stripes > 0, "StripedAccumulator needs at least one stripe");
+
+    private:
+        using Parts = detail::AccumulatorParts<T>;
+        using Re = typename Parts::Re;
+        using Im = typename Parts::Im;
+
+        struct alignas(64) Stripe
+        {
+            // Writers in progress are begun - ended; readers retry while any are
+            std::atomic<std::uint64_t> begun{0};
+            std::atomic<std::uint64_t> ended{0};
+            std::atomic<Re> re{Re{}};
+            std::atomic<Im> im{Im{}};
+        };
+
+        Stripe stripes[Stripes];
+
+        void add(Re re, Im im) noexcept
+        {
+            Stripe &s = stripes[detail::threadStripe() % Stripes];
+            if constexpr (Parts::complex)
+            {
+                s.begun.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                detail::atomicAdd(s.re, re, std::memory_order_relaxed);
+                detail::atomicAdd(s.im, im, std::memory_order_relaxed);
+                s.ended.fetch_add(1, std::memory_order_release);
+            }
+            else
+            {
+                (void)im;
+                detail::atomicAdd(s.re, re, std::memory_order_relaxed);
+            }
+        }
+
+    public:
+        StripedAccumulator() = default;
+        StripedAccumulator(const StripedAccumulator &) = delete;
+        StripedAccumulator &operator=(const StripedAccumulator &) = delete;
+
+        /// Adds x; safe to call from any number of threads.
+        StripedAccumulator &operator+=(const T &x) noexcept
+        {
+            if constexpr (Parts::complex)
+                add(x.getReal(), x.getImg());
+            else
+                add(x, Im{});
+            return *this;
+        }
+
+        StripedAccumulator &operator+=(const Type<T> &x) noexcept { return *this += x.get(); }
+
+        /**
+         * @brief Sum of everything added so far.
+         */
+        T load() const noexcept
+        {
+            Re re{};
+            Im im{};
+            for (const Stripe &s : stripes)
+            {
+                if constexpr (Parts::complex)
+                {
+                    for (;;)
+                    {
+                        std::uint64_t e = s.ended.load(std::memory_order_acquire);
+                        Re r = s.re.load(std::memory_order_relaxed);
+                        Im i = s.im.load(std::memory_order_relaxed);
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        if (s.begun.load(std::memory_order_relaxed) == e)
+                        {
+                            re += r;
+                            im += i;
+                            break;
+                        }
+                    }
+                }
+                else
+                    re += s.re.load(std::memory_order_acquire);
+            }
+            if constexpr (Parts::complex)
+                return T(re, im);
+            else
+                return re;
+        }
+
+        /// Sum as a Type<T>.
+        Type<T> get() const { return Type<T>(load()); }
+
+        /**
+         * @brief Sets the sum to zero. Must not run concurrently with +=.
+         */
+        void reset() noexcept
+        {
+            for (Stripe &s : stripes)
+            {
+                s.re.store(Re{}, std::memory_order_relaxed);
+                s.im.store(Im{}, std::memory_order_relaxed);
+                s.begun.store(0, std::memory_order_relaxed);
+                s.ended.store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+}
@@ -0,0 +1,1054 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file BigInt.hpp
+ * @brief Arbitrary-precision signed integers with size-dependent multiplication.
+ *
+ * A BigInt stores a sign and a magnitude of 64-bit limbs, least significant
+ * first. Magnitudes of up to INLINE_LIMBS limbs (128 bits) live inside the
+ * object, so values that fit in an int64_t never touch the heap; larger ones
+ * move to a heap buffer that grows geometrically.
+ *
+ * Multiplication picks the algorithm by the size of the smaller operand:
+ *  - below KARATSUBA_THRESHOLD limbs: schoolbook, O(n^2);
+ *  - below TOOM3_THRESHOLD limbs: Karatsuba, three half-size products, O(n^1.58);
+ *  - above: Toom-3, five third-size products, O(n^1.46).
+ * Unbalanced operands are cut into pieces the size of the smaller one.
+ *
+ * Division is Knuth's algorithm D. Like int, quotients truncate toward zero
+ * and the remainder has the sign of the dividend; dividing by zero throws.
+ */
+
+namespace myStd
+{
+    namespace detail
+    {
+        using Limb = std::uint64_t;
+        __extension__ typedef unsigned __int128 DoubleLimb;
+
+        /// Products with the smaller operand below this many limbs use the schoolbook method.
+        constexpr std::size_t KARATSUBA_THRESHOLD = 32;
+
+        /// Balanced products from this many limbs use Toom-3 instead of Karatsuba.
+        constexpr std::size_t TOOM3_THRESHOLD = 384;
+
+        /// Length of a without leading zero limbs.
+        inline std::size_t trimmed(const Limb *a, std::size_t n) noexcept
+        {
+            while (n > 0 && a[n - 1] == 0)
+                --n;
+            return n;
+        }
+
+        /// Compares a and b, both without leading zero limbs: -1, 0 or 1.
+        inline int compareLimbs(const Limb *a, std::size_t an, const Limb *b, std::size_t bn) noexcept
+        {
+            if (an != bn)
+                return an < bn ? -1 : 1;
+            for (std::size_t i = an; i-- > 0;)
+                if (a[i] != b[i])
+                    return a[i] < b[i] ? -1 : 1;
+            return 0;
+        }
+
+        /// r[0, an) = a + b for an >= bn; returns the carry out. r may alias a.
+        inline Limb addLimbs(Limb *r, const Limb *a, std::size_t an, const Limb *b, std::size_t bn) noexcept
+        {
+            Limb carry = 0;
+            std::size_t i = 0;
+            for (; i < bn; ++i)
+            {
+                Limb s = a[i] + b[i];
+                Limb c = s < a[i];
+                r[i] = s + carry;
+                carry = c | (r[i] < s);
+            }
+            for (; i < an; ++i)
+            {
+                r[i] = a[i] + carry;
+                carry = r[i] < carry;
+            }
+            return carry;
+        }
+
+        /// r[0, an) = a - b for an >= bn; returns the borrow out. r may alias a.
+        inline Limb subLimbs(Limb *r, const Limb *a, std::size_t an, const Limb *b, std::size_t bn) noexcept
+        {
+            Limb borrow = 0;
+            std::size_t i = 0;
+            for (; i < bn; ++i)
+            {
+                Limb d = a[i] - b[i];
+                Limb c = a[i] < b[i];
+                r[i] = d - borrow;
+                borrow = c | (d < borrow);
+            }
+            for (; i < an; ++i)
+            {
+                Limb d = a[i];
+                r[i] = d - borrow;
+                borrow = d < borrow;
+            }
+            return borrow;
+        }
+
+        /// r[0, rn) += a[0, an) for rn >= an; the carry must not run past rn.
+        inline void addInto(Limb *r, std::size_t rn, const Limb *a, std::size_t an) noexcept
+        {
+            Limb carry = addLimbs(r, r, an, a, an);
+            for (std::size_t i = an; carry && i < rn; ++i)
+            {
+                r[i] += 1;
+                carry = r[i] == 0;
+            }
+        }
+
+        /// r[0, n) = a * m; returns the high limb.
+        inline Limb mulLimb(Limb *r, const Limb *a, std::size_t n, Limb m) noexcept
+        {
+            Limb carry = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                DoubleLimb t = static_cast<DoubleLimb>(a[i]) * m + carry;
+                r[i] = static_cast<Limb>(t);
+                carry = static_cast<Limb>(t >> 64);
+            }
+            return carry;
+        }
+
+        /// r[0, n) += a * m; returns the high limb.
+        inline Limb addMulLimb(Limb *r, const Limb *a, std::size_t n, Limb m) noexcept
+        {
+            Limb carry = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                DoubleLimb t = static_cast<DoubleLimb>(a[i]) * m + r[i] + carry;
+                r[i] = static_cast<Limb>(t);
+                carry = static_cast<Limb>(t >> 64);
+            }
+            return carry;
+        }
+
+        /// q[0, n) = a / d; returns the remainder. q may alias a.
+        inline Limb divLimb(Limb *q, const Limb *a, std::size_t n, Limb d) noexcept
+        {
+            Limb rem = 0;
+            for (std::size_t i = n; i-- > 0;)
+            {
+                DoubleLimb cur = (static_cast<DoubleLimb>(rem) << 64) | a[i];
+                q[i] = static_cast<Limb>(cur / d);
+                rem = static_cast<Limb>(cur % d);
+            }
+            return rem;
+        }
+
+        /// r[0, n) = a << s for 0 <= s < 64; returns the bits shifted out. r may alias a.
+        inline Limb shiftLeft(Limb *r, const Limb *a, std::size_t n, unsigned s) noexcept
+        {
+            if (s == 0)
+            {
+                std::copy(a, a + n, r);
+                return 0;
+            }
+            Limb out = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                Limb v = a[i];
+                r[i] = (v << s) | out;
+                out = v >> (64 - s);
+            }
+            return out;
+        }
+
+        /// r[0, n) = a >> s for 0 <= s < 64. r may alias a.
+        inline void shiftRight(Limb *r, const Limb *a, std::size_t n, unsigned s) noexcept
+        {
+            if (s == 0)
+            {
+                std::copy(a, a + n, r);
+                return;
+            }
+            for (std::size_t i = 0; i < n; ++i)
+                r[i] = (a[i] >> s) | (i + 1 < n ? a[i + 1] << (64 - s) : 0);
+        }
+
+        /// r[0, an + bn) = a * b, the quadratic method. r must not alias a or b.
+        inline void mulSchoolbook(Limb *r, const Limb *a, std::size_t an, const Limb *b, std::size_t bn) noexcept
+        {
+            r[an] = mulLimb(r, a, an, b[0]);
+            for (std::size_t j = 1; j < bn; ++j)
+                r[an + j] = addMulLimb(r + j, a, an, b[j]);
+        }
+
+        inline void mulLimbs(Limb *r, const Limb *a, std::size_t an, const Limb *b, std::size_t bn);
+
+        /// Scratch limbs mulKaratsuba needs for n-limb operands.
+        inline std::size_t karatsubaScratch(std::size_t n) noexcept
+        {
+            return 8 * n + 64;
+        }
+
+        /// r[0, n) = |a - b| for operands of an and bn <= n limbs; returns true if a < b.
+        inline bool absDiff(Limb *r, const Limb *a, std::size_t an, const Limb *b, std::size_t bn, std::size_t n) noexcept
+        {
+            an = trimmed(a, an);
+            bn = trimmed(b, bn);
+            bool less = compareLimbs(a, an, b, bn) < 0;
+            if (less)
+            {
+                std::swap(a, b);
+                std::swap(an, bn);
+            }
+            subLimbs(r, a, an, b, bn);
+            std::fill(r + an, r + n, Limb(0));
+            return less;
+        }
+
+        /**
+         * @brief r[0, 2n) = a * b for n-limb operands by Karatsuba's method.
+         *
+         * With a = a1 B^l + a0 and b = b1 B^l + b0, the middle coefficient
+         * a1 b0 + a0 b1 is a0 b0 + a1 b1 - (a0 - a1)(b0 - b1), so three half-size
+         * products replace four. The differences are taken as magnitudes with a
+         * sign, which keeps every intermediate at l limbs.
+         */
+        inline void mulKaratsuba(Limb *r, const Limb *a, const Limb *b, std::size_t n, Limb *scratch) noexcept
+        {
+            if (n < KARATSUBA_THRESHOLD)
+            {
+                mulSchoolbook(r, a, n, b, n);
+                return;
+            }
+            std::size_t h = n / 2, l = n - h;
+            Limb *da = scratch, *db = da + l, *mid = db + l, *sum = mid + 2 * l, *next = sum + 2 * l + 1;
+
+            mulKaratsuba(r, a, b, l, next);
+            mulKaratsuba(r + 2 * l, a + l, b + l, h, next);
+
+            bool negA = absDiff(da, a, l, a + l, h, l);
+            bool negB = absDiff(db, b, l, b + l, h, l);
+            mulKaratsuba(mid, da, db, l, next);
+
+            // sum = a0 b0 + a1 b1 -+ |a0 - a1| |b0 - b1|, never negative
+            sum[2 * l] = addLimbs(sum, r, 2 * l, r + 2 * l, 2 * h);
+            if (negA == negB)
+                subLimbs(sum, sum, 2 * l + 1, mid, 2 * l);
+            else
+                addLimbs(sum, sum, 2 * l + 1, mid, 2 * l);
+            addInto(r + l, 2 * n - l, sum, std::min(2 * l + 1, 2 * n - l));
+        }
+
+        /// Magnitude with a sign, for the negative intermediates of Toom-3.
+        struct SignedLimbs
+        {
+            std::vector<Limb> mag;
+            bool neg = false;
+
+            void trim()
+            {
+                mag.resize(trimmed(mag.data(), mag.size()));
+                if (mag.empty())
+                    neg = false;
+            }
+        };
+
+        inline SignedLimbs toSigned(const Limb *a, std::size_t n)
+        {
+            SignedLimbs s{std::vector<Limb>(a, a + n), false};
+            s.trim();
+            return s;
+        }
+
+        /// a + b, or a - b when negateB is set.
+        inline SignedLimbs addSigned(const SignedLimbs &a, const SignedLimbs &b, bool negateB = false)
+        {
+            bool bNeg = b.neg != negateB;
+            const SignedLimbs *x = &a, *y = &b;
+            SignedLimbs r;
+            if (a.neg == bNeg)
+            {
+                if (x->mag.size() < y->mag.size())
+                    std::swap(x, y);
+                r.mag.resize(x->mag.size() + 1);
+                r.mag.back() = addLimbs(r.mag.data(), x->mag.data(), x->mag.size(), y->mag.data(), y->mag.size());
+                r.neg = a.neg;
+            }
+            else
+            {
+                bool yNeg = bNeg;
+                if (compareLimbs(x->mag.data(), x->mag.size(), y->mag.data(), y->mag.size()) < 0)
+                {
+                    std::swap(x, y);
+                    yNeg = a.neg;
+                }
+                r.mag.resize(x->mag.size());
+                subLimbs(r.mag.data(), x->mag.data(), x->mag.size(), y->mag.data(), y->mag.size());
+                r.neg = !yNeg;
+            }
+            r.trim();
+            return r;
+        }
+
+        /// a * 2^s for 0 <= s < 64.
+        inline SignedLimbs shiftSigned(const SignedLimbs &a, unsigned s)
+        {
+            SignedLimbs r{std::vector<Limb>(a.mag.size() + 1), a.neg};
+            r.mag.back() = shiftLeft(r.mag.data(), a.mag.data(), a.mag.size(), s);
+            r.trim();
+            return r;
+        }
+
+        /// a / d for a multiple a of d.
+        inline SignedLimbs divExact(SignedLimbs a, Limb d)
+        {
+            divLimb(a.mag.data(), a.mag.data(), a.mag.size(), d);
+            a.trim();
+            return a;
+        }
+
+        inline SignedLimbs mulSigned(const SignedLimbs &a, const SignedLimbs &b)
+        {
+            SignedLimbs r;
+            if (a.mag.empty() || b.mag.empty())
+                return r;
+            r.mag.assign(a.mag.size() + b.mag.size(), 0);
+            mulLimbs(r.mag.data(), a.mag.data(), a.mag.size(), b.mag.data(), b.mag.size());
+            r.neg = a.neg != b.neg;
+            r.trim();
+            return r;
+        }
+
+        /**
+         * @brief r[0, 2n) = a * b for n-limb operands by Toom-3.
+         *
+         * Splits both operands into three k-limb parts, evaluates them as
+         * polynomials in B^k at 0, 1, -1, -2 and infinity, multiplies the five
+         * values pointwise and interpolates the product's five coefficients
+         * with Bodrato's sequence (two exact halvings and one exact division
+         * by 3).
+         */
+        inline void mulToom3(Limb *r, const Limb *a, const Limb *b, std::size_t n)
+        {
+            std::size_t k = (n + 2) / 3;
+            auto evaluate = [&](const Limb *x, SignedLimbs v[5])
+            {
+                SignedLimbs x0 = toSigned(x, k), x1 = toSigned(x + k, k), x2 = toSigned(x + 2 * k, n - 2 * k);
+                SignedLimbs p = addSigned(x0, x2);
+                v[1] = addSigned(p, x1);
+                v[2] = addSigned(p, x1, true);
+                v[3] = addSigned(shiftSigned(addSigned(v[2], x2), 1), x0, true);
+                v[0] = std::move(x0);
+                v[4] = std::move(x2);
+            };
+            SignedLimbs pa[5], pb[5], w[5];
+            evaluate(a, pa);
+            evaluate(b, pb);
+            for (int i = 0; i < 5; ++i)
+                w[i] = mulSigned(pa[i], pb[i]);
+
+            // w = r(0), r(1), r(-1), r(-2), r(inf) -> coefficients c0..c4
+            SignedLimbs c3 = divExact(addSigned(w[3], w[1], true), 3);
+            SignedLimbs c1 = divExact(addSigned(w[1], w[2], true), 2);
+            SignedLimbs c2 = addSigned(w[2], w[0], true);
+            c3 = addSigned(divExact(addSigned(c2, c3, true), 2), shiftSigned(w[4], 1));
+            c2 = addSigned(addSigned(c2, c1), w[4], true);
+            c1 = addSigned(c1, c3, true);
+
+            std::fill(r, r + 2 * n, Limb(0));
+            const SignedLimbs *coeffs[5] = {&w[0], &c1, &c2, &c3, &w[4]};
+            for (std::size_t i = 0; i < 5; ++i)
+                if (!coeffs[i]->mag.empty())
+                    addInto(r + i * k, 2 * n - i * k, coeffs[i]->mag.data(), coeffs[i]->mag.size());
+        }
+
+        /**
+         * @brief r[0, an + bn) = a * b, choosing the method by operand size.
+         *        r need not be initialized and must not alias a or b.
+         */
+        inline void mulLimbs(Limb *r, const Limb *a, std::size_t an, const Limb *b, std::size_t bn)
+        {
+            if (an < bn)
+            {
+                std::swap(a, b);
+                std::swap(an, bn);
+            }
+            if (bn < KARATSUBA_THRESHOLD)
+            {
+                mulSchoolbook(r, a, an, b, bn);
+                return;
+            }
+            if (an == bn)
+            {
+                if (bn >= TOOM3_THRESHOLD)
+                    mulToom3(r, a, b, bn);
+                else
+                {
+                    std::vector<Limb> scratch(karatsubaScratch(bn));
+                    mulKaratsuba(r, a, b, bn, scratch.data());
+                }
+                return;
+            }
+            // Unbalanced: bn-limb pieces of a times b, added at their offsets
+            std::fill(r, r + an + bn, Limb(0));
+            std::vector<Limb> part(2 * bn);
+            std::size_t off = 0;
+            for (; off + bn <= an; off += bn)
+            {
+                mulLimbs(part.data(), a + off, bn, b, bn);
+                addInto(r + off, an + bn - off, part.data(), 2 * bn);
+            }
+            if (off < an)
+            {
+                std::size_t rest = an - off;
+                mulLimbs(part.data(), b, bn, a + off, rest);
+                addInto(r + off, an + bn - off, part.data(), bn + rest);
+            }
+        }
+
+        /**
+         * @brief q[0, un - vn + 1) = u / v and r[0, vn) = u % v by Knuth's algorithm D.
+         *        Needs vn >= 2, un >= vn and no leading zero limb in v.
+         */
+        inline void divModLimbs(Limb *q, Limb *r, const Limb *u, std::size_t un, const Limb *v, std::size_t vn)
+        {
+            unsigned s = static_cast<unsigned>(__builtin_clzll(v[vn - 1]));
+            std::vector<Limb> vs(vn), us(un + 1);
+            shiftLeft(vs.data(), v, vn, s);
+            us[un] = shiftLeft(us.data(), u, un, s);
+            Limb top = vs[vn - 1], second = vs[vn - 2];
+
+            for (std::size_t j = un - vn + 1; j-- > 0;)
+            {
+                // Estimate the quotient limb from the top two limbs; it is at most 2 too large
+                DoubleLimb num = (static_cast<DoubleLimb>(us[j + vn]) << 64) | us[j + vn - 1];
+                DoubleLimb qhat = num / top, rhat = num % top;
+                while ((qhat >> 64) != 0 || qhat * second > ((rhat << 64) | us[j + vn - 2]))
+                {
+                    --qhat;
+                    rhat += top;
+                    if ((rhat >> 64) != 0)
+                        break;
+                }
+
+                // us[j, j + vn] -= qhat * vs
+                Limb mulCarry = 0, borrow = 0;
+                for (std::size_t i = 0; i < vn; ++i)
+                {
+                    DoubleLimb p = qhat * vs[i] + mulCarry;
+                    mulCarry = static_cast<Limb>(p >> 64);
+                    Limb lo = static_cast<Limb>(p), x = us[i + j];
+                    Limb d = x - lo;
+                    Limb c = x < lo;
+                    us[i + j] = d - borrow;
+                    borrow = c | (d < borrow);
+                }
+                Limb x = us[j + vn];
+                Limb d = x - mulCarry;
+                Limb c = x < mulCarry;
+                us[j + vn] = d - borrow;
+                borrow = c | (d < borrow);
+
+                // The estimate was one too large: add v back
+                if (borrow)
+                {
+                    --qhat;
+                    us[j + vn] += addLimbs(us.data() + j, us.data() + j, vn, vs.data(), vn);
+                }
+                q[j] = static_cast<Limb>(qhat);
+            }
+            shiftRight(r, us.data(), vn, s);
+        }
+    }
+
+    /**
+     * @brief Arbitrary-precision signed integer.
+     *
+     * Converts implicitly from the built-in integer types, so mixed expressions
+     * such as x * 3 + y work as they do for int. Conversion from floating point
+     * truncates toward zero and is explicit; conversion to arithmetic types is
+     * explicit, rounding to floating point and wrapping modulo 2^64 to integers.
+     */
+    class BigInt
+    {
+    public:
+        using Limb = detail::Limb;
+
+        /// Limbs stored inside the object; larger magnitudes go to the heap.
+        static constexpr std::size_t INLINE_LIMBS = 2;
+
+    private:
+        std::uint32_t len = 0;            // Limbs in use, without leading zeros; 0 for zero
+        std::uint32_t cap = INLINE_LIMBS; // Limbs available; more than INLINE_LIMBS means heap
+        bool neg = false;                 // Sign; never set for zero
+        union
+        {
+            Limb small[INLINE_LIMBS] = {};
+            Limb *heap;
+        };
+
+        bool onHeap() const noexcept { return cap > INLINE_LIMBS; }
+        Limb *limbs() noexcept { return onHeap() ? heap : small; }
+
+        /// Makes room for n limbs, keeping the current ones.
+        void reserve(std::size_t n)
+        {
+            if (n <= cap)
+                return;
+            if (n > UINT32_MAX)
+                throw(std::runtime_error("BigInt too large!"));
+            std::size_t newCap = std::max<std::size_t>(n, std::min<std::size_t>(2 * std::size_t(cap), UINT32_MAX));
+            Limb *p = new Limb[newCap];
+            std::copy(data(), data() + len, p);
+            release();
+            heap = p;
+            cap = static_cast<std::uint32_t>(newCap);
+        }
+
+        void release() noexcept
+        {
+            if (onHeap())
+                delete[] heap;
+        }
+
+        /// Sets the length to n limbs, which the caller has written, and drops leading zeros.
+        void setLength(std::size_t n) noexcept
+        {
+            len = static_cast<std::uint32_t>(detail::trimmed(data(), n));
+            if (len == 0)
+                neg = false;
+        }
+
+        /// Value with n zeroed limbs of room and the given sign.
+        static BigInt withRoom(std::size_t n, bool negative)
+        {
+            BigInt r;
+            r.reserve(n);
+            std::fill(r.limbs(), r.limbs() + n, Limb(0));
+            r.neg = negative;
+            return r;
+        }
+
+        /// |a| + |b| or |a| - |b| with the given sign for the result; subtraction needs |a| >= |b|.
+        static BigInt addMagnitudes(const BigInt &a, const BigInt &b, bool subtract, bool negative)
+        {
+            const BigInt *x = &a, *y = &b;
+            if (!subtract && x->len < y->len)
+                std::swap(x, y);
+            BigInt r = withRoom(x->len + 1, negative);
+            if (subtract)
+                detail::subLimbs(r.limbs(), x->data(), x->len, y->data(), y->len);
+            else
+                r.limbs()[x->len] = detail::addLimbs(r.limbs(), x->data(), x->len, y->data(), y->len);
+            r.setLength(x->len + 1);
+            return r;
+        }
+
+        /// Value with a magnitude below 2^128, which always fits inline.
+        static BigInt fromWide(detail::DoubleLimb m, bool negative) noexcept
+        {
+            BigInt r;
+            r.small[0] = static_cast<Limb>(m);
+            r.small[1] = static_cast<Limb>(m >> 64);
+            r.len = r.small[1] ? 2 : r.small[0] != 0;
+            r.neg = negative && r.len != 0;
+            return r;
+        }
+
+        /// Lowest limb of the magnitude; the whole magnitude when len <= 1.
+        Limb low() const noexcept { return len ? data()[0] : 0; }
+
+        /// a + b, with b's sign replaced by bNeg.
+        static BigInt addSigned(const BigInt &a, const BigInt &b, bool bNeg)
+        {
+            // One limb each: one 128-bit add, no loops
+            if (a.len <= 1 && b.len <= 1)
+            {
+                Limb x = a.low(), y = b.low();
+                if (a.neg == bNeg)
+                    return fromWide(static_cast<detail::DoubleLimb>(x) + y, a.neg);
+                return x >= y ? fromWide(x - y, a.neg) : fromWide(y - x, bNeg);
+            }
+            if (b.len == 0)
+                return a;
+            if (a.neg == bNeg)
+                return addMagnitudes(a, b, false, a.neg);
+            int c = compareMagnitude(a, b);
+            if (c == 0)
+                return BigInt();
+            return c > 0 ? addMagnitudes(a, b, true, a.neg) : addMagnitudes(b, a, true, bNeg);
+        }
+
+        static int compareMagnitude(const BigInt &a, const BigInt &b) noexcept
+        {
+            return detail::compareLimbs(a.data(), a.len, b.data(), b.len);
+        }
+
+        /// Sets the magnitude from an unsigned 64-bit value.
+        void setMagnitude(std::uint64_t m) noexcept
+        {
+            limbs()[0] = m;
+            len = m != 0;
+        }
+
+    public:
+        // =========================
+        // Constructors & Destructor
+        // =========================
+
+        /**
+         * @brief Default constructor. Creates zero without allocating.
+         */
+        BigInt() noexcept {}
+
+        /**
+         * @brief Converts a built-in integer exactly.
+         */
+        template <typename I, std::enable_if_t<std::is_integral_v<I>, int> = 0>
+        BigInt(I v) noexcept
+        {
+            static_assert(sizeof(I) <= sizeof(Limb), "BigInt converts integers of up to 64 bits");
+            using U = std::make_unsigned_t<I>;
+            U m = static_cast<U>(v);
+            if constexpr (std::is_signed_v<I>)
+                if (v < 0)
+                {
+                    m = static_cast<U>(U(0) - m);
+                    neg = true;
+                }
+            setMagnitude(m);
+        }
+
+        /**
+         * @brief Converts a floating-point value, truncating toward zero.
+         * @throws std::runtime_error for infinity or NaN.
+         */
+        template <typename F, std::enable_if_t<std::is_floating_point_v<F>, int> = 0>
+        explicit BigInt(F v)
+        {
+            double d = static_cast<double>(v);
+            if (!std::isfinite(d))
+                throw(std::runtime_error("Can't convert infinity or NaN to BigInt!"));
+            int e;
+            double frac = std::frexp(std::trunc(std::fabs(d)), &e);
+            if (e <= 0)
+                return;
+            // |d| = m * 2^(e - 53) with a 53-bit integer m
+            auto m = static_cast<std::uint64_t>(std::ldexp(frac, 53));
+            if (e <= 53)
+                setMagnitude(m >> (53 - e));
+            else
+            {
+                std::size_t shift = static_cast<std::size_t>(e - 53), whole = shift / 64;
+                unsigned bits = static_cast<unsigned>(shift % 64);
+                Limb high = bits ? m >> (64 - bits) : 0;
+                std::size_t n = whole + 1 + (high != 0);
+                reserve(n);
+                Limb *p = limbs();
+                std::fill(p, p + n, Limb(0));
+                p[whole] = m << bits;
+                if (high)
+                    p[whole + 1] = high;
+                setLength(n);
+            }
+            neg = d < 0 && len != 0;
+        }
+
+        /**
+         * @brief Parses a decimal integer with an optional sign, e.g. "-123456789012345678901234567890".
+         * @throws std::runtime_error if text is not a decimal integer.
+         */
+        explicit BigInt(std::string_view text)
+        {
+            std::size_t i = 0;
+            bool negative = false;
+            if (i < text.size() && (text[i] == '+' || text[i] == '-'))
+                negative = text[i++] == '-';
+            if (i == text.size())
+                throw(std::runtime_error("Malformed number: " + std::string(text)));
+            // Up to 39 digits may fit inline; longer values take about 19.3 digits per limb
+            if (text.size() - i > 39)
+                reserve((text.size() - i) / 19 + 1);
+            for (; i < text.size();)
+            {
+                // Up to 19 digits at a time: *this = *this * 10^count + chunk
+                Limb chunk = 0, scale = 1;
+                for (int count = 0; count < 19 && i < text.size(); ++count, ++i)
+                {
+                    if (text[i] < '0' || text[i] > '9')
+                        throw(std::runtime_error("Malformed number: " + std::string(text)));
+                    chunk = chunk * 10 + static_cast<Limb>(text[i] - '0');
+                    scale *= 10;
+                }
+                Limb *p = limbs();
+                Limb carry = detail::mulLimb(p, p, len, scale);
+                for (std::size_t k = 0; chunk && k < len; ++k)
+                {
+                    p[k] += chunk;
+                    chunk = p[k] < chunk;
+                }
+                carry += chunk;
+                if (carry)
+                {
+                    reserve(len + 1);
+                    limbs()[len++] = carry;
+                }
+            }
+            neg = negative && len != 0;
+        }
+
+        /**
+         * @brief Builds a value from n limbs, least significant first.
+         */
+        static BigInt fromLimbs(const Limb *digits, std::size_t n, bool negative)
+        {
+            BigInt r;
+            r.reserve(n);
+            std::copy(digits, digits + n, r.limbs());
+            r.neg = negative;
+            r.setLength(n);
+            return r;
+        }
+
+        BigInt(const BigInt &o) : neg(o.neg)
+        {
+            reserve(o.len);
+            std::copy(o.data(), o.data() + o.len, limbs());
+            len = o.len;
+        }
+
+        /**
+         * @brief Move constructor. Takes over the heap buffer; o becomes zero.
+         */
+        BigInt(BigInt &&o) noexcept : len(o.len), cap(o.cap), neg(o.neg)
+        {
+            if (o.onHeap())
+                heap = o.heap;
+            else
+                std::copy(o.small, o.small + INLINE_LIMBS, small);
+            o.len = 0;
+            o.cap = INLINE_LIMBS;
+            o.neg = false;
+        }
+
+        ~BigInt() { release(); }
+
+        // =========================
+        // Assignment Operators
+        // =========================
+
+        /**
+         * @brief Copy assignment. Reuses the existing buffer when it is large enough.
+         */
+        BigInt &operator=(const BigInt &o)
+        {
+            if (this != &o)
+            {
+                len = 0;
+                reserve(o.len);
+                std::copy(o.data(), o.data() + o.len, limbs());
+                len = o.len;
+                neg = o.neg;
+            }
+            return *this;
+        }
+
+        BigInt &operator=(BigInt &&o) noexcept
+        {
+            if (this != &o)
+            {
+                release();
+                len = o.len;
+                cap = o.cap;
+                neg = o.neg;
+                if (o.onHeap())
+                    heap = o.heap;
+                else
+                    std::copy(o.small, o.small + INLINE_LIMBS, small);
+                o.len = 0;
+                o.cap = INLINE_LIMBS;
+                o.neg = false;
+            }
+            return *this;
+        }
+
+        // =========================
+        // Accessors
+        // =========================
+
+        /// Magnitude limbs, least significant first; limbCount() of them.
+        const Limb *data() const noexcept { return onHeap() ? heap : small; }
+
+        /// Number of limbs in the magnitude; 0 for zero.
+        std::size_t limbCount() const noexcept { return len; }
+
+        /// true if the value is stored inside the object, without a heap buffer.
+        bool isInline() const noexcept { return !onHeap(); }
+
+        bool isZero() const noexcept { return len == 0; }
+        bool isNegative() const noexcept { return neg; }
+
+        /// -1, 0 or 1.
+        int sign() const noexcept { return len == 0 ? 0 : (neg ? -1 : 1); }
+
+        /// Number of bits in the magnitude; 0 for zero.
+        std::size_t bitLength() const noexcept
+        {
+            return len == 0 ? 0 : 64 * std::size_t(len) - static_cast<std::size_t>(__builtin_clzll(data()[len - 1]));
+        }
+
+        /// Absolute value.
+        BigInt abs() const
+        {
+            BigInt r(*this);
+            r.neg = false;
+            return r;
+        }
+
+        /**
+         * @brief Converts to an arithmetic type: floating point rounds (infinity when out
+         *        of range), integers wrap modulo 2^64 like a two's complement cast.
+         */
+        template <typename A, std::enable_if_t<std::is_arithmetic_v<A>, int> = 0>
+        explicit operator A() const noexcept
+        {
+            if constexpr (std::is_same_v<A, bool>)
+                return len != 0;
+            else if constexpr (std::is_floating_point_v<A>)
+            {
+                // The top three limbs hold more than enough bits for a double
+                const Limb *p = data();
+                std::size_t low = len > 3 ? len - 3 : 0;
+                double r = 0.0;
+                for (std::size_t i = len; i-- > low;)
+                    r = r * 18446744073709551616.0 + static_cast<double>(p[i]);
+                r = std::ldexp(r, static_cast<int>(std::min<std::size_t>(64 * low, 1 << 20)));
+                return static_cast<A>(neg ? -r : r);
+            }
+            else
+            {
+                Limb m = len ? data()[0] : 0;
+                return static_cast<A>(neg ? Limb(0) - m : m);
+            }
+        }
+
+        /**
+         * @brief Decimal representation, e.g. "-12345".
+         */
+        std::string toString() const
+        {
+            if (len == 0)
+                return "0";
+            constexpr Limb CHUNK = 10000000000000000000ULL; // 10^19
+            std::vector<Limb> rest(data(), data() + len);
+            std::vector<Limb> chunks;
+            std::size_t n = len;
+            while (n > 0)
+            {
+                chunks.push_back(detail::divLimb(rest.data(), rest.data(), n, CHUNK));
+                n = detail::trimmed(rest.data(), n);
+            }
+            std::string s = neg ? "-" : "";
+            s += std::to_string(chunks.back());
+            for (std::size_t i = chunks.size() - 1; i-- > 0;)
+            {
+                std::string part = std::to_string(chunks[i]);
+                s.append(19 - part.size(), '0');
+                s += part;
+            }
+            return s;
+        }
+
+        // =========================
+        // Arithmetic Operators
+        // =========================
+
+        friend BigInt operator+(const BigInt &a, const BigInt &b) { return addSigned(a, b, b.neg); }
+        friend BigInt operator-(const BigInt &a, const BigInt &b) { return addSigned(a, b, b.len != 0 && !b.neg); }
+
+        BigInt operator-() const
+        {
+            BigInt r(*this);
+            r.neg = len != 0 && !neg;
+            return r;
+        }
+
+        /**
+         * @brief Product: schoolbook, Karatsuba or Toom-3 depending on the operand sizes.
+         */
+        friend BigInt operator*(const BigInt &a, const BigInt &b)
+        {
+            if (a.len <= 1 && b.len <= 1)
+                return fromWide(static_cast<detail::DoubleLimb>(a.low()) * b.low(), a.neg != b.neg);
+            if (a.len == 0 || b.len == 0)
+                return BigInt();
+            std::size_t n = std::size_t(a.len) + b.len;
+            BigInt r = withRoom(n, a.neg != b.neg);
+            if (a.len == 1 || b.len == 1)
+            {
+                const BigInt &big = a.len == 1 ? b : a, &one = a.len == 1 ? a : b;
+                r.limbs()[big.len] = detail::mulLimb(r.limbs(), big.data(), big.len, one.data()[0]);
+            }
+            else
+                detail::mulLimbs(r.limbs(), a.data(), a.len, b.data(), b.len);
+            r.setLength(n);
+            return r;
+        }
+
+        /**
+         * @brief Quotient and remainder in one division: q truncates toward zero, r has the sign of a.
+         * @throws std::runtime_error if b is zero.
+         */
+        static void divMod(const BigInt &a, const BigInt &b, BigInt &q, BigInt &r)
+        {
+            if (b.len == 0)
+                throw(std::runtime_error("Division by zero!"));
+            if (compareMagnitude(a, b) < 0)
+            {
+                r = a;
+                q = BigInt();
+                return;
+            }
+            BigInt quot = withRoom(a.len - b.len + 1, a.neg != b.neg);
+            BigInt rem = withRoom(b.len, a.neg);
+            if (b.len == 1)
+            {
+                rem.limbs()[0] = detail::divLimb(quot.limbs(), a.data(), a.len, b.data()[0]);
+            }
+            else
+                detail::divModLimbs(quot.limbs(), rem.limbs(), a.data(), a.len, b.data(), b.len);
+            quot.setLength(a.len - b.len + 1);
+            rem.setLength(b.len);
+            q = std::move(quot);
+            r = std::move(rem);
+        }
+
+        friend BigInt operator/(const BigInt &a, const BigInt &b)
+        {
+            BigInt q, r;
+            divMod(a, b, q, r);
+            return q;
+        }
+
+        friend BigInt operator%(const BigInt &a, const BigInt &b)
+        {
+            BigInt q, r;
+            divMod(a, b, q, r);
+            return r;
+        }
+
+        BigInt &operator+=(const BigInt &o) { return *this = *this + o; }
+        BigInt &operator-=(const BigInt &o) { return *this = *this - o; }
+        BigInt &operator*=(const BigInt &o) { return *this = *this * o; }
+        BigInt &operator/=(const BigInt &o) { return *this = *this / o; }
+        BigInt &operator%=(const BigInt &o) { return *this = *this % o; }
+
+        // =========================
+        // Comparison Operators
+        // =========================
+
+        friend bool operator==(const BigInt &a, const BigInt &b) noexcept
+        {
+            return a.neg == b.neg && compareMagnitude(a, b) == 0;
+        }
+
+        friend bool operator<(const BigInt &a, const BigInt &b) noexcept
+        {
+            if (a.neg != b.neg)
+                return a.neg;
+            int c = compareMagnitude(a, b);
+            return a.neg ? c > 0 : c < 0;
+        }
+
+        friend bool operator!=(const BigInt &a, const BigInt &b) noexcept { return !(a == b); }
+        friend bool operator>(const BigInt &a, const BigInt &b) noexcept { return b < a; }
+        friend bool operator<=(const BigInt &a, const BigInt &b) noexcept { return !(b < a); }
+        friend bool operator>=(const BigInt &a, const BigInt &b) noexcept { return !(a < b); }
+
+        // =========================
+        // I/O Operators
+        // =========================
+
+        /**
+         * @brief Prints the value in decimal.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const BigInt &v)
+        {
+            return os << v.toString();
+        }
+
+        /**
+         * @brief Reads a decimal integer; sets failbit if the next word is not one.
+         */
+        friend std::istream &operator>>(std::istream &is, BigInt &v)
+        {
+            std::string word;
+            if (!(is >> word))
+                return is;
+            try
+            {
+                v = BigInt(std::string_view(word));
+            }
+            catch (const std::runtime_error &)
+            {
+                is.setstate(std::ios::failbit);
+            }
+            return is;
+        }
+    };
+
+    // =========================
+    // Text Conversion
+    // =========================
+
+    /**
+     * @brief Parses one decimal integer of any length, with an optional sign; the BigInt overload of Parse.hpp's parse().
+     * @return Pointer past the value and std::errc() on success, first and an error otherwise.
+     */
+    inline std::from_chars_result parse(const char *first, const char *last, BigInt &out)
+    {
+        const char *p = first;
+        if (p != last && (*p == '+' || *p == '-'))
+            ++p;
+        const char *digits = p;
+        while (p != last && *p >= '0' && *p <= '9')
+            ++p;
+        if (p == digits)
+            return {first, std::errc::invalid_argument};
+        out = BigInt(std::string_view(first, static_cast<std::size_t>(p - first)));
+        return {p, std::errc()};
+    }
+
+    /**
+     * @brief Writes a BigInt in decimal.
+     * @return Pointer past the text and std::errc(), or last and std::errc::value_too_large.
+     */
+    inline std::to_chars_result format(char *first, char *last, const BigInt &value)
+    {
+        std::string s = value.toString();
+        if (static_cast<std::size_t>(last - first) < s.size())
+            return {last, std::errc::value_too_large};
+        return {std::copy(s.begin(), s.end(), first), std::errc()};
+    }
+
+    /**
+     * @brief Formats a BigInt of any length into a new string.
+     */
+    inline std::string toString(const BigInt &value)
+    {
+        return value.toString();
+    }
+}
@@ -1,6 +1,8 @@
 #pragma once
 #include <iostream>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 
 namespace myStd
 {
@@ -18,8 +20,8 @@ namespace myStd
     class Complex
     {
     private:
-        T real; ///< Real part of the complex number
-        U img;  ///< Imaginary part of the complex number
+        T real{}; ///< Real part of the complex number
+        U img{};  ///< Imaginary part of the complex number
 
         // Allow all instantiations of Type<T> to access private members
         template <typename>
@@ -27,23 +29,23 @@ namespace myStd
 
     public:
         /**
-         * @brief Default constructor. Initializes real and imaginary parts to default values.
+         * @brief Default constructor. Initializes real and imaginary parts to zero.
          */
-        Complex() = default;
+        constexpr Complex() = default;
 
         /**
          * @brief Parameterized constructor.
          * @param real Real part.
          * @param img Imaginary part.
          */
-        Complex(T real, U img) : real(real), img(img) {}
+        constexpr Complex(T real, U img) noexcept : real(real), img(img) {}
 
         /**
          * @brief Addition operator.
          * @param obj Complex number to add.
          * @return Sum as a new Complex object.
          */
-        Complex<T, U> operator+(const Complex<T, U> &obj)
+        constexpr Complex<T, U> operator+(const Complex<T, U> &obj) const noexcept
         {
             return {this->real + obj.real, this->img + obj.img};
         }
@@ -53,7 +55,7 @@ namespace myStd
          * @param obj Complex number to add.
          * @return Reference to this object.
          */
-        Complex<T, U> &operator+=(const Complex<T, U> &obj)
+        constexpr Complex<T, U> &operator+=(const Complex<T, U> &obj) noexcept
         {
             this->real += obj.real;
             this->img += obj.img;
@@ -65,7 +67,7 @@ namespace myStd
          * @param obj Complex number to subtract.
          * @return Difference as a new Complex object.
          */
-        Complex<T, U> operator-(const Complex<T, U> &obj)
+        constexpr Complex<T, U> operator-(const Complex<T, U> &obj) const noexcept
         {
             return {this->real - obj.real, this->img - obj.img};
         }
@@ -75,7 +77,7 @@ namespace myStd
          * @param obj Complex number to subtract.
          * @return Reference to this object.
          */
-        Complex<T, U> &operator-=(const Complex<T, U> &obj)
+        constexpr Complex<T, U> &operator-=(const Complex<T, U> &obj) noexcept
         {
             this->real -= obj.real;
             this->img -= obj.img;
@@ -87,11 +89,11 @@ namespace myStd
          * @param obj Complex number to multiply.
          * @return Product as a new Complex object.
          */
-        Complex<T, U> operator*(const Complex<T, U> &obj)
+        constexpr Complex<T, U> operator*(const Complex<T, U> &obj) const noexcept
         {
             return {
-                this->real * obj.real - this->img * obj.img,
-                this->real * obj.img + this->img * obj.real};
+                static_cast<T>(this->real * obj.real - this->img * obj.img),
+                static_cast<U>(this->real * obj.img + this->img * obj.real)};
         }
 
         /**
@@ -99,9 +101,11 @@ namespace myStd
          * @param obj Complex number to multiply.
          * @return Reference to this object.
          */
-        Complex<T, U> &operator*=(const Complex<T, U> &obj)
+        constexpr Complex<T, U> &operator*=(const Complex<T, U> &obj) noexcept
         {
-            *this = *this * obj;
+            T re = static_cast<T>(this->real * obj.real - this->img * obj.img);
+            this->img = static_cast<U>(this->real * obj.img + this->img * obj.real);
+            this->real = re;
             return *this;
         }
 
@@ -110,12 +114,21 @@ namespace myStd
          * @param obj Complex number to divide by.
          * @return Quotient as a new Complex object.
          */
-        Complex<T, U> operator/(const Complex<T, U> &obj)
+        constexpr Complex<T, U> operator/(const Complex<T, U> &obj) const noexcept
         {
-            T denom = obj.real * obj.real + obj.img * obj.img;
-            return {
-                (this->real * obj.real + this->img * obj.img) / denom,
-                (this->img * obj.real - this->real * obj.img) / denom};
+            // Denominator in the wider of T and U, so Complex<int, double> keeps its fraction
+            using C = std::common_type_t<T, U>;
+            C denom = static_cast<C>(obj.real * obj.real + obj.img * obj.img);
+            C re = static_cast<C>(this->real * obj.real + this->img * obj.img);
+            C im = static_cast<C>(this->img * obj.real - this->real * obj.img);
+            if constexpr (std::is_floating_point_v<C>)
+            {
+                // One division, two multiplications
+                C inv = C(1) / denom;
+                return {static_cast<T>(re * inv), static_cast<U>(im * inv)};
+            }
+            else
+                return {static_cast<T>(re / denom), static_cast<U>(im / denom)};
         }
 
         /**
@@ -123,10 +136,9 @@ namespace myStd
          * @param obj Complex number to divide by.
          * @return Reference to this object.
          */
-        Complex<T, U> &operator/=(const Complex<T, U> &obj)
+        constexpr Complex<T, U> &operator/=(const Complex<T, U> &obj) noexcept
         {
-            *this = *this / obj;
-            return *this;
+            return *this = *this / obj;
         }
 
         /**
@@ -134,11 +146,10 @@ namespace myStd
          * @param obj Complex number to compare.
          * @return true if this object's magnitude is less than obj's.
          */
-        bool operator<(const Complex<T, U> &obj)
+        constexpr bool operator<(const Complex<T, U> &obj) const noexcept
         {
-            auto mag1 = std::sqrt(this->real * this->real + this->img * this->img);
-            auto mag2 = std::sqrt(obj.real * obj.real + obj.img * obj.img);
-            return mag1 < mag2;
+            // sqrt is monotonic, so comparing squared magnitudes gives the same order
+            return this->norm() < obj.norm();
         }
 
         /**
@@ -146,11 +157,9 @@ namespace myStd
          * @param obj Complex number to compare.
          * @return true if this object's magnitude is greater than obj's.
          */
-        bool operator>(const Complex<T, U> &obj)
+        constexpr bool operator>(const Complex<T, U> &obj) const noexcept
         {
-            auto mag1 = std::sqrt(this->real * this->real + this->img * this->img);
-            auto mag2 = std::sqrt(obj.real * obj.real + obj.img * obj.img);
-            return mag1 > mag2;
+            return this->norm() > obj.norm();
         }
 
         /**
@@ -158,9 +167,9 @@ namespace myStd
          * @param obj Complex number to compare.
          * @return true if both real and imaginary parts are equal.
          */
-        bool operator==(const Complex<T, U> &obj) const
+        constexpr bool operator==(const Complex<T, U> &obj) const noexcept
         {
-            return std::tie(real, img) == std::tie(obj.real, obj.img);
+            return real == obj.real && img == obj.img;
         }
 
         /**
@@ -168,18 +177,45 @@ namespace myStd
          * @param obj Complex number to compare.
          * @return true if either real or imaginary part differs.
          */
-        bool operator!=(const Complex<T, U> &obj)
+        constexpr bool operator!=(const Complex<T, U> &obj) const noexcept
         {
             return !(*this == obj);
         }
 
+        /**
+         * @brief Returns the real part.
+         * @return Real part.
+         */
+        constexpr T getReal() const noexcept
+        {
+            return real;
+        }
+
+        /**
+         * @brief Returns the imaginary part.
+         * @return Imaginary part.
+         */
+        constexpr U getImg() const noexcept
+        {
+            return img;
+        }
+
+        /**
+         * @brief Returns the squared magnitude, real^2 + img^2, without a square root.
+         * @return Squared magnitude.
+         */
+        constexpr auto norm() const noexcept
+        {
+            return this->real * this->real + this->img * this->img;
+        }
+
         /**
          * @brief Returns the magnitude (absolute value) of the complex number.
          * @return Magnitude as double.
          */
-        double getValue()
+        double getValue() const
         {
-            return std::sqrt(this->real * this->real + this->img * this->img);
+            return std::sqrt(norm());
         }
 
         /**
@@ -0,0 +1,172 @@
+#pragma once
+#include <array>
+#include <memory>
+#include <stdexcept>
+
+#include "Utils.hpp"
+#include "Instrument.hpp"
+#include "Numeric.hpp"
+#include "Promotion.hpp"
+#include "TypeTag.hpp"
+
+/**
+ * @file Dispatch.hpp
+ * @brief Tables of (lhs tag, rhs tag) -> kernel used by Type<T>'s mixed-type operators.
+ *
+ * Each kernel knows both concrete types at compile time, so a mixed-type
+ * operation is a single indexed indirect call instead of a dynamic_cast chain.
+ */
+
+namespace myStd
+{
+    template <typename T>
+    class Type;
+
+    namespace detail
+    {
+        /// Wraps the result of a static operation into a heap-allocated Type.
+        template <typename R>
+        std::unique_ptr<Numeric> wrap(const R &result)
+        {
+            return std::make_unique<Type<R>>(result);
+        }
+
+        /// Counts the right operand of a promoting complex operation being reduced to its magnitude.
+        template <typename L, typename R>
+        void countComplexFallback()
+        {
+            if constexpr (is_complex<L>::value && is_complex<R>::value && !std::is_same_v<L, R>)
+                instrument::count(instrument::Event::ComplexFallback);
+        }
+
+        /// Kernel for operator+.
+        struct AddKernel
+        {
+            template <typename L, typename R>
+            static promote_t<L, R> compute(const L &a, const R &b) { return ops::add(a, b); }
+
+            template <typename L, typename R>
+            static std::unique_ptr<Numeric> apply(Numeric &a, Numeric &b)
+            {
+                countComplexFallback<L, R>();
+                return wrap(compute(static_cast<Type<L> &>(a).get(), static_cast<Type<R> &>(b).get()));
+            }
+        };
+
+        /// Kernel for operator-.
+        struct SubKernel
+        {
+            template <typename L, typename R>
+            static promote_t<L, R> compute(const L &a, const R &b) { return ops::sub(a, b); }
+
+            template <typename L, typename R>
+            static std::unique_ptr<Numeric> apply(Numeric &a, Numeric &b)
+            {
+                countComplexFallback<L, R>();
+                return wrap(compute(static_cast<Type<L> &>(a).get(), static_cast<Type<R> &>(b).get()));
+            }
+        };
+
+        /// Kernel for operator*. Throws for rectangular complex operands, like the polymorphic path.
+        struct MulKernel
+        {
+            template <typename L, typename R>
+            static promote_t<L, R> compute(const L &a, const R &b) { return ops::mul(a, b); }
+
+            template <typename L, typename R>
+            static std::unique_ptr<Numeric> apply(Numeric &a, Numeric &b)
+            {
+                if constexpr (rejects_mul_div_v<L, R>)
+                {
+                    instrument::count(instrument::Event::ComplexError);
+                    throw(std::runtime_error("Can't do this operation for complex numbers"));
+                }
+                else
+                    return wrap(compute(static_cast<Type<L> &>(a).get(), static_cast<Type<R> &>(b).get()));
+            }
+        };
+
+        /// Kernel for operator/. Throws for rectangular complex operands, like the polymorphic path.
+        struct DivKernel
+        {
+            template <typename L, typename R>
+            static promote_t<L, R> compute(const L &a, const R &b) { return ops::div(a, b); }
+
+            template <typename L, typename R>
+            static std::unique_ptr<Numeric> apply(Numeric &a, Numeric &b)
+            {
+                if constexpr (rejects_mul_div_v<L, R>)
+                {
+                    instrument::count(instrument::Event::ComplexError);
+                    throw(std::runtime_error("Can't do this operation for complex numbers"));
+                }
+                else
+                    return wrap(compute(static_cast<Type<L> &>(a).get(), static_cast<Type<R> &>(b).get()));
+            }
+        };
+
+        /// Kernel for operator<.
+        struct LessKernel
+        {
+            template <typename L, typename R>
+            static bool apply(Numeric &a, Numeric &b)
+            {
+                return ops::less(static_cast<Type<L> &>(a).get(), static_cast<Type<R> &>(b).get());
+            }
+        };
+
+        /// Function pointer type of a kernel's entries.
+        template <typename Kernel>
+        using KernelFn = decltype(&Kernel::template apply<int, int>);
+
+        template <typename Kernel, typename L, typename... Rs>
+        constexpr std::array<KernelFn<Kernel>, sizeof...(Rs)> makeRow(TypeList<Rs...>)
+        {
+            return {{&Kernel::template apply<L, Rs>...}};
+        }
+
+        template <typename Kernel, typename... Ls>
+        constexpr std::array<std::array<KernelFn<Kernel>, sizeof...(Ls)>, sizeof...(Ls)> makeTable(TypeList<Ls...> list)
+        {
+            return {{makeRow<Kernel, Ls>(list)...}};
+        }
+
+        /// Dispatch table of a kernel, indexed as table[lhs tag][rhs tag].
+        template <typename Kernel>
+        inline constexpr auto dispatchTable = makeTable<Kernel>(NumericTypes{});
+
+        /// Compound form of an arithmetic kernel: a op= b stores a op b, converted back to L. No allocation.
+        template <typename Kernel>
+        struct AssignKernel
+        {
+            template <typename L, typename R>
+            static void apply(L &a, Numeric &b)
+            {
+                a = L(Kernel::compute(a, static_cast<Type<R> &>(b).get()));
+            }
+        };
+
+        template <typename Kernel, typename L, typename... Rs>
+        constexpr std::array<void (*)(L &, Numeric &), sizeof...(Rs)> makeAssignRow(TypeList<Rs...>)
+        {
+            return {{&AssignKernel<Kernel>::template apply<L, Rs>...}};
+        }
+
+        /// Compound dispatch row of a kernel for a left operand of type L, indexed by the rhs tag.
+        template <typename Kernel, typename L>
+        inline constexpr auto assignRow = makeAssignRow<Kernel, L>(NumericTypes{});
+
+        /**
+         * @brief a op= b with the same promotion as a op b. b's value is read through the
+         *        row when b is tagged and through getValue() otherwise.
+         */
+        template <typename Kernel, typename L>
+        void assignThrough(L &a, Numeric &b)
+        {
+            if (b.getTag() == noTag)
+                a = L(Kernel::compute(a, b.getValue()));
+            else
+                assignRow<Kernel, L>[b.getTag()](a, b);
+        }
+    }
+}
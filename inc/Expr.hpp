@@ -0,0 +1,312 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "NumericVector.hpp"
+#include "Promotion.hpp"
+#include "Type.hpp"
+
+/**
+ * @file Expr.hpp
+ * @brief Expression templates: lazily built arithmetic expressions evaluated in a single pass.
+ *
+ * Wrapping operands with lazy() makes + - * / build a lightweight expression
+ * tree instead of computing temporaries. eval() or assign() then walks the tree
+ * once per element, so `a + b * c - d` over NumericVectors reads each input once,
+ * writes the output once and allocates nothing in between:
+ *
+ * @code
+ * NumericVector<double> a, b, c, d;
+ * NumericVector<double> r = eval(lazy(a) + lazy(b) * lazy(c) - lazy(d));
+ *
+ * Type<int> x(1), y(2);
+ * double s = eval(lazy(x) * 0.5 + lazy(y)); // scalar, no unique_ptr<Numeric> temporaries
+ * @endcode
+ *
+ * Mixed-type elements follow the promotion rules of Type<T> (see Promotion.hpp).
+ * Same-type complex * and / are allowed; mixed complex * and / do not compile.
+ */
+
+namespace myStd
+{
+    namespace expr
+    {
+        /// Size of an expression made only of scalars; it broadcasts to any length.
+        constexpr std::size_t BROADCAST = std::numeric_limits<std::size_t>::max();
+
+        /**
+         * @brief CRTP base of every expression node.
+         * @tparam Derived Concrete node type, providing operator[](i) and size().
+         */
+        template <typename Derived>
+        struct Expr
+        {
+            const Derived &self() const
+            {
+                return static_cast<const Derived &>(*this);
+            }
+        };
+
+        /**
+         * @brief Leaf referring to a NumericVector. Must not outlive the vector.
+         */
+        template <typename T>
+        class VectorRef : public Expr<VectorRef<T>>
+        {
+        private:
+            const NumericVector<T> *vec;
+
+        public:
+            explicit VectorRef(const NumericVector<T> &vec) : vec(&vec) {}
+
+            T operator[](std::size_t i) const
+            {
+                return (*vec)[i];
+            }
+
+            std::size_t size() const
+            {
+                return vec->size();
+            }
+        };
+
+        /**
+         * @brief Leaf holding a scalar value broadcast to every element.
+         */
+        template <typename T>
+        class Scalar : public Expr<Scalar<T>>
+        {
+        private:
+            T val;
+
+        public:
+            explicit Scalar(T val) : val(val) {}
+
+            T operator[](std::size_t) const
+            {
+                return val;
+            }
+
+            std::size_t size() const
+            {
+                return BROADCAST;
+            }
+        };
+
+        /// Element operation for +.
+        struct AddOp
+        {
+            template <typename A, typename B>
+            static auto apply(const A &a, const B &b)
+            {
+                return ops::add(a, b);
+            }
+        };
+
+        /// Element operation for -.
+        struct SubOp
+        {
+            template <typename A, typename B>
+            static auto apply(const A &a, const B &b)
+            {
+                return ops::sub(a, b);
+            }
+        };
+
+        /// Element operation for *. Same-type complex values use Complex::operator*.
+        struct MulOp
+        {
+            template <typename A, typename B>
+            static auto apply(const A &a, const B &b)
+            {
+                if constexpr (std::is_same_v<A, B>)
+                    return a * b;
+                else
+                    return ops::mul(a, b);
+            }
+        };
+
+        /// Element operation for /. Same-type complex values use Complex::operator/.
+        struct DivOp
+        {
+            template <typename A, typename B>
+            static auto apply(const A &a, const B &b)
+            {
+                if constexpr (std::is_same_v<A, B>)
+                    return a / b;
+                else
+                    return ops::div(a, b);
+            }
+        };
+
+        /**
+         * @brief Node applying Op element-wise to two sub-expressions.
+         */
+        template <typename Op, typename L, typename R>
+        class Binary : public Expr<Binary<Op, L, R>>
+        {
+        private:
+            L lhs;
+            R rhs;
+
+        public:
+            /**
+             * @throws std::runtime_error if both operands are vectors of different sizes.
+             */
+            Binary(const L &lhs, const R &rhs) : lhs(lhs), rhs(rhs)
+            {
+                if (lhs.size() != BROADCAST && rhs.size() != BROADCAST && lhs.size() != rhs.size())
+                    throw(std::runtime_error("Size mismatch!"));
+            }
+
+            auto operator[](std::size_t i) const
+            {
+                return Op::apply(lhs[i], rhs[i]);
+            }
+
+            std::size_t size() const
+            {
+                return lhs.size() != BROADCAST ? lhs.size() : rhs.size();
+            }
+        };
+
+        /// True if the expression tree contains at least one vector leaf.
+        template <typename E>
+        struct HasVector : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct HasVector<VectorRef<T>> : std::true_type
+        {
+        };
+
+        template <typename Op, typename L, typename R>
+        struct HasVector<Binary<Op, L, R>> : std::bool_constant<HasVector<L>::value || HasVector<R>::value>
+        {
+        };
+
+        /// True for values that can appear as scalars in an expression.
+        template <typename T>
+        constexpr bool isScalar = std::is_arithmetic_v<T> || is_fixed_v<T> || is_complex<T>::value;
+
+        /// Element type of an expression.
+        template <typename E>
+        using ValueOf = std::decay_t<decltype(std::declval<const E &>()[0])>;
+
+        // =========================
+        // Building Expressions
+        // =========================
+
+        /**
+         * @brief Wraps a scalar (arithmetic, Complex or Type<T>) as an expression leaf.
+         */
+        template <typename T, typename = std::enable_if_t<isScalar<T>>>
+        Scalar<T> lazy(const T &val)
+        {
+            return Scalar<T>(val);
+        }
+
+        template <typename T>
+        Scalar<T> lazy(const Type<T> &val)
+        {
+            return Scalar<T>(val.get());
+        }
+
+        /**
+         * @brief Wraps a NumericVector as an expression leaf.
+         */
+        template <typename T>
+        VectorRef<T> lazy(const NumericVector<T> &vec)
+        {
+            return VectorRef<T>(vec);
+        }
+
+#define MYSTD_EXPR_OPERATOR(op, Op)                                                              \
+    template <typename L, typename R>                                                            \
+    Binary<Op, L, R> operator op(const Expr<L> &lhs, const Expr<R> &rhs)                         \
+    {                                                                                            \
+        return Binary<Op, L, R>(lhs.self(), rhs.self());                                         \
+    }                                                                                            \
+    template <typename L, typename S, typename = std::enable_if_t<isScalar<S>>>                  \
+    Binary<Op, L, Scalar<S>> operator op(const Expr<L> &lhs, const S &rhs)                       \
+    {                                                                                            \
+        return Binary<Op, L, Scalar<S>>(lhs.self(), Scalar<S>(rhs));                             \
+    }                                                                                            \
+    template <typename S, typename R, typename = std::enable_if_t<isScalar<S>>>                  \
+    Binary<Op, Scalar<S>, R> operator op(const S &lhs, const Expr<R> &rhs)                       \
+    {                                                                                            \
+        return Binary<Op, Scalar<S>, R>(Scalar<S>(lhs), rhs.self());                             \
+    }
+
+        MYSTD_EXPR_OPERATOR(+, AddOp)
+        MYSTD_EXPR_OPERATOR(-, SubOp)
+        MYSTD_EXPR_OPERATOR(*, MulOp)
+        MYSTD_EXPR_OPERATOR(/, DivOp)
+
+#undef MYSTD_EXPR_OPERATOR
+
+        // =========================
+        // Evaluation
+        // =========================
+
+        /**
+         * @brief Evaluates a vector expression into an existing vector in one pass.
+         * @param out Destination, resized to the expression's size. May also appear
+         *            in the expression, element i is read before it is written.
+         * @param e Expression to evaluate.
+         */
+        template <typename T, typename E>
+        void assign(NumericVector<T> &out, const Expr<E> &e)
+        {
+            static_assert(HasVector<E>::value, "assign() needs an expression with a vector operand");
+            const E &x = e.self();
+            std::size_t n = x.size();
+            out.resize(n);
+            if constexpr (is_complex<T>::value)
+            {
+                auto *re = out.realData();
+                auto *im = out.imagData();
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    T v = x[i];
+                    re[i] = v.getReal();
+                    im[i] = v.getImg();
+                }
+            }
+            else
+            {
+                T *dst = out.raw();
+                for (std::size_t i = 0; i < n; ++i)
+                    dst[i] = static_cast<T>(x[i]);
+            }
+        }
+
+        /**
+         * @brief Evaluates an expression.
+         * @return A NumericVector of the element type if the expression contains a
+         *         vector, the scalar value otherwise.
+         */
+        template <typename E>
+        auto eval(const Expr<E> &e)
+        {
+            if constexpr (HasVector<E>::value)
+            {
+                NumericVector<ValueOf<E>> out;
+                assign(out, e);
+                return out;
+            }
+            else
+                return e.self()[0];
+        }
+    }
+
+    using expr::assign;
+    using expr::eval;
+    using expr::lazy;
+}
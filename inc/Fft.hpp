@@ -0,0 +1,608 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+#include "Complex.hpp"
+
+/**
+ * @file Fft.hpp
+ * @brief Fast Fourier transforms over contiguous arrays of Complex<F, F>.
+ *
+ * @code
+ * std::vector<Complex<double, double>> x(4096), X(4096);
+ * fft(x.data(), X.data(), x.size());     // out of place
+ * ifft(X.data(), X.size());              // in place, scaled by 1/n: X == x again
+ * @endcode
+ *
+ * Any size n >= 1 is supported. n is factored into radix-4, radix-2, then
+ * radix-3, 5 and larger prime stages, run as a Stockham autosort FFT: each
+ * stage reads one buffer and writes the other, so no bit-reversal pass is
+ * needed and every access is unit stride within a group. Sizes whose prime
+ * factors are small are fastest; a large prime factor p costs O(n * p).
+ *
+ * Twiddle factors are computed once per size and kept in a plan. fftPlan(n)
+ * returns a cached plan shared by all threads; plans are immutable, and the
+ * scratch buffer a transform needs is per thread, so one plan may run on many
+ * threads at once.
+ *
+ * With AVX, radix-2 and radix-4 butterflies on double process two complex
+ * values per instruction. The forward transform is unscaled; the inverse is
+ * scaled by 1/n, so ifft(fft(x)) == x.
+ *
+ * Real input: rfft transforms n real samples with one complex FFT of size n/2
+ * and returns the n/2 + 1 non-redundant bins; irfft is its inverse.
+ */
+
+namespace myStd
+{
+    namespace detail
+    {
+        template <typename F>
+        struct FftStage
+        {
+            std::size_t radix;                  ///< Points per butterfly
+            std::size_t span;                   ///< Product of the radices of earlier stages
+            std::vector<Complex<F, F>> twiddles; ///< w^(r*k) at [(r - 1) * span + k], w = e^(-2 pi i / (span * radix))
+            std::vector<Complex<F, F>> roots;   ///< e^(-2 pi i t / radix) for generic radices
+        };
+
+        /// e^(-2 pi i num / den), computed in double.
+        template <typename F>
+        Complex<F, F> unitRoot(std::size_t num, std::size_t den)
+        {
+            constexpr double TWO_PI = 6.283185307179586476925286766559;
+            double angle = -TWO_PI * static_cast<double>(num % den) / static_cast<double>(den);
+            return Complex<F, F>(static_cast<F>(std::cos(angle)), static_cast<F>(std::sin(angle)));
+        }
+
+        /// a * w for the forward transform, a * conj(w) for the inverse.
+        template <bool Inv, typename F>
+        inline Complex<F, F> twiddleMul(const Complex<F, F> &a, const Complex<F, F> &w) noexcept
+        {
+            F wr = w.getReal(), wi = Inv ? -w.getImg() : w.getImg();
+            return Complex<F, F>(a.getReal() * wr - a.getImg() * wi, a.getReal() * wi + a.getImg() * wr);
+        }
+
+        /// a * -i for the forward transform, a * i for the inverse.
+        template <bool Inv, typename F>
+        inline Complex<F, F> rotate(const Complex<F, F> &a) noexcept
+        {
+            return Inv ? Complex<F, F>(-a.getImg(), a.getReal()) : Complex<F, F>(a.getImg(), -a.getReal());
+        }
+
+        // =========================
+        // Scalar Butterflies
+        // =========================
+
+        /// One radix-2 stage for the groups' k in [k0, span).
+        template <bool Inv, typename F>
+        void radix2(const Complex<F, F> *in, Complex<F, F> *out, std::size_t n, const FftStage<F> &st, std::size_t k0)
+        {
+            const std::size_t ns = st.span, m = n / 2;
+            const Complex<F, F> *tw = st.twiddles.data();
+            for (std::size_t q = 0; q < m / ns; ++q)
+            {
+                const Complex<F, F> *src = in + q * ns;
+                Complex<F, F> *dst = out + q * ns * 2;
+                for (std::size_t k = k0; k < ns; ++k)
+                {
+                    Complex<F, F> a = src[k], b = twiddleMul<Inv>(src[k + m], tw[k]);
+                    dst[k] = a + b;
+                    dst[k + ns] = a - b;
+                }
+            }
+        }
+
+        /// One radix-4 stage for the groups' k in [k0, span).
+        template <bool Inv, typename F>
+        void radix4(const Complex<F, F> *in, Complex<F, F> *out, std::size_t n, const FftStage<F> &st, std::size_t k0)
+        {
+            const std::size_t ns = st.span, m = n / 4;
+            const Complex<F, F> *tw = st.twiddles.data();
+            for (std::size_t q = 0; q < m / ns; ++q)
+            {
+                const Complex<F, F> *src = in + q * ns;
+                Complex<F, F> *dst = out + q * ns * 4;
+                for (std::size_t k = k0; k < ns; ++k)
+                {
+                    Complex<F, F> v0 = src[k];
+                    Complex<F, F> v1 = twiddleMul<Inv>(src[k + m], tw[k]);
+                    Complex<F, F> v2 = twiddleMul<Inv>(src[k + 2 * m], tw[ns + k]);
+                    Complex<F, F> v3 = twiddleMul<Inv>(src[k + 3 * m], tw[2 * ns + k]);
+                    Complex<F, F> a0 = v0 + v2, a1 = v0 - v2, a2 = v1 + v3, a3 = rotate<Inv>(v1 - v3);
+                    dst[k] = a0 + a2;
+                    dst[k + ns] = a1 + a3;
+                    dst[k + 2 * ns] = a0 - a2;
+                    dst[k + 3 * ns] = a1 - a3;
+                }
+            }
+        }
+
+        /// One stage of any radix p, as a direct size-p DFT per butterfly.
+        template <bool Inv, typename F>
+        void radixGeneric(const Complex<F, F> *in, Complex<F, F> *out, std::size_t n, const FftStage<F> &st)
+        {
+            const std::size_t p = st.radix, ns = st.span, m = n / p;
+            const Complex<F, F> *tw = st.twiddles.data();
+            std::vector<Complex<F, F>> v(p);
+            for (std::size_t q = 0; q < m / ns; ++q)
+            {
+                const Complex<F, F> *src = in + q * ns;
+                Complex<F, F> *dst = out + q * ns * p;
+                for (std::size_t k = 0; k < ns; ++k)
+                {
+                    v[0] = src[k];
+                    for (std::size_t r = 1; r < p; ++r)
+                        v[r] = twiddleMul<Inv>(src[k + r * m], tw[(r - 1) * ns + k]);
+                    for (std::size_t s = 0; s < p; ++s)
+                    {
+                        Complex<F, F> acc = v[0];
+                        for (std::size_t r = 1, t = s; r < p; ++r, t = (t + s) % p)
+                            acc = acc + twiddleMul<Inv>(v[r], st.roots[t]);
+                        dst[k + s * ns] = acc;
+                    }
+                }
+            }
+        }
+
+        // =========================
+        // AVX Butterflies (double)
+        // =========================
+
+#if defined(__AVX__)
+        /// Two complex products a * w (or a * conj(w)) on [re0, im0, re1, im1].
+        template <bool Inv>
+        inline __m256d cmul2(__m256d a, __m256d w) noexcept
+        {
+            if (Inv)
+                w = _mm256_xor_pd(w, _mm256_set_pd(-0.0, 0.0, -0.0, 0.0));
+            __m256d wr = _mm256_movedup_pd(w);
+            __m256d wi = _mm256_permute_pd(w, 0xF);
+            __m256d swapped = _mm256_permute_pd(a, 0x5);
+            return _mm256_addsub_pd(_mm256_mul_pd(a, wr), _mm256_mul_pd(swapped, wi));
+        }
+
+        /// Two products by -i (forward) or i (inverse).
+        template <bool Inv>
+        inline __m256d rotate2(__m256d a) noexcept
+        {
+            __m256d swapped = _mm256_permute_pd(a, 0x5);
+            return Inv ? _mm256_xor_pd(swapped, _mm256_set_pd(0.0, -0.0, 0.0, -0.0))
+                       : _mm256_xor_pd(swapped, _mm256_set_pd(-0.0, 0.0, -0.0, 0.0));
+        }
+
+        inline __m256d load2(const Complex<double, double> *p) noexcept
+        {
+            return _mm256_loadu_pd(reinterpret_cast<const double *>(p));
+        }
+
+        inline void store2(Complex<double, double> *p, __m256d v) noexcept
+        {
+            _mm256_storeu_pd(reinterpret_cast<double *>(p), v);
+        }
+
+        /// Radix-2 stage, two butterflies per iteration; returns the first k left for the scalar loop.
+        template <bool Inv>
+        std::size_t radix2Avx(const Complex<double, double> *in, Complex<double, double> *out, std::size_t n,
+                              const FftStage<double> &st)
+        {
+            const std::size_t ns = st.span, m = n / 2, kv = ns & ~std::size_t(1);
+            const Complex<double, double> *tw = st.twiddles.data();
+            for (std::size_t q = 0; q < m / ns; ++q)
+            {
+                const Complex<double, double> *src = in + q * ns;
+                Complex<double, double> *dst = out + q * ns * 2;
+                for (std::size_t k = 0; k < kv; k += 2)
+                {
+                    __m256d a = load2(src + k), b = cmul2<Inv>(load2(src + k + m), load2(tw + k));
+                    store2(dst + k, _mm256_add_pd(a, b));
+                    store2(dst + k + ns, _mm256_sub_pd(a, b));
+                }
+            }
+            return kv;
+        }
+
+        /// Radix-4 stage, two butterflies per iteration; returns the first k left for the scalar loop.
+        template <bool Inv>
+        std::size_t radix4Avx(const Complex<double, double> *in, Complex<double, double> *out, std::size_t n,
+                              const FftStage<double> &st)
+        {
+            const std::size_t ns = st.span, m = n / 4, kv = ns & ~std::size_t(1);
+            const Complex<double, double> *tw = st.twiddles.data();
+            for (std::size_t q = 0; q < m / ns; ++q)
+            {
+                const Complex<double, double> *src = in + q * ns;
+                Complex<double, double> *dst = out + q * ns * 4;
+                for (std::size_t k = 0; k < kv; k += 2)
+                {
+                    __m256d v0 = load2(src + k);
+                    __m256d v1 = cmul2<Inv>(load2(src + k + m), load2(tw + k));
+                    __m256d v2 = cmul2<Inv>(load2(src + k + 2 * m), load2(tw + ns + k));
+                    __m256d v3 = cmul2<Inv>(load2(src + k + 3 * m), load2(tw + 2 * ns + k));
+                    __m256d a0 = _mm256_add_pd(v0, v2), a1 = _mm256_sub_pd(v0, v2);
+                    __m256d a2 = _mm256_add_pd(v1, v3), a3 = rotate2<Inv>(_mm256_sub_pd(v1, v3));
+                    store2(dst + k, _mm256_add_pd(a0, a2));
+                    store2(dst + k + ns, _mm256_add_pd(a1, a3));
+                    store2(dst + k + 2 * ns, _mm256_sub_pd(a0, a2));
+                    store2(dst + k + 3 * ns, _mm256_sub_pd(a1, a3));
+                }
+            }
+            return kv;
+        }
+#endif
+
+        /// Runs one stage from in to out.
+        template <bool Inv, typename F>
+        void runStage(const Complex<F, F> *in, Complex<F, F> *out, std::size_t n, const FftStage<F> &st)
+        {
+            std::size_t k0 = 0;
+            if (st.radix == 4)
+            {
+#if defined(__AVX__)
+                if constexpr (std::is_same_v<F, double>)
+                    k0 = radix4Avx<Inv>(in, out, n, st);
+#endif
+                if (k0 < st.span)
+                    radix4<Inv>(in, out, n, st, k0);
+            }
+            else if (st.radix == 2)
+            {
+#if defined(__AVX__)
+                if constexpr (std::is_same_v<F, double>)
+                    k0 = radix2Avx<Inv>(in, out, n, st);
+#endif
+                if (k0 < st.span)
+                    radix2<Inv>(in, out, n, st, k0);
+            }
+            else
+                radixGeneric<Inv>(in, out, n, st);
+        }
+
+        /// Per-thread scratch buffer of at least n values.
+        template <typename F>
+        Complex<F, F> *fftScratch(std::size_t n)
+        {
+            thread_local std::vector<Complex<F, F>> scratch;
+            if (scratch.size() < n)
+                scratch.resize(n);
+            return scratch.data();
+        }
+    }
+
+    /**
+     * @brief Precomputed factorization and twiddle factors for complex FFTs of one size.
+     *
+     * @tparam F float or double.
+     */
+    template <typename F>
+    class FftPlan
+    {
+        static_assert(std::is_floating_point_v<F>, "FftPlan requires float or double");
+
+    private:
+        using C = Complex<F, F>;
+
+        std::size_t n;
+        std::vector<detail::FftStage<F>> stages;
+
+        template <bool Inv>
+        void run(const C *in, C *out) const
+        {
+            if (n <= 1)
+            {
+                if (n == 1 && in != out)
+                    out[0] = in[0];
+                return;
+            }
+            // Ping-pong between out and scratch, starting so that the last stage writes out.
+            // In place, the first stage must not overwrite its input, so it writes scratch.
+            C *scratch = detail::fftScratch<F>(n);
+            bool toOut = in != out && stages.size() % 2 == 1;
+            const C *src = in;
+            for (const auto &st : stages)
+            {
+                C *dst = toOut ? out : scratch;
+                detail::runStage<Inv>(src, dst, n, st);
+                src = dst;
+                toOut = !toOut;
+            }
+            if (src != out)
+                std::copy(src, src + n, out);
+            if constexpr (Inv)
+            {
+                F scale = F(1) / static_cast<F>(n);
+                for (std::size_t i = 0; i < n; ++i)
+                    out[i] = C(out[i].getReal() * scale, out[i].getImg() * scale);
+            }
+        }
+
+    public:
+        /**
+         * @brief Factors n and computes the twiddle factors.
+         * @param n Transform size, at least 1.
+         * @throws std::runtime_error if n is 0.
+         */
+        explicit FftPlan(std::size_t n) : n(n)
+        {
+            if (n == 0)
+                throw(std::runtime_error("FFT size must be positive"));
+            std::vector<std::size_t> radices;
+            std::size_t rest = n;
+            while (rest % 4 == 0)
+            {
+                radices.push_back(4);
+                rest /= 4;
+            }
+            if (rest % 2 == 0)
+            {
+                radices.push_back(2);
+                rest /= 2;
+            }
+            for (std::size_t p = 3; rest > 1; p += 2)
+            {
+                if (p * p > rest)
+                    p = rest;
+                while (rest % p == 0)
+                {
+                    radices.push_back(p);
+                    rest /= p;
+                }
+            }
+
+            std::size_t span = 1;
+            for (std::size_t radix : radices)
+            {
+                detail::FftStage<F> st{radix, span, {}, {}};
+                st.twiddles.resize((radix - 1) * span);
+                for (std::size_t r = 1; r < radix; ++r)
+                    for (std::size_t k = 0; k < span; ++k)
+                        st.twiddles[(r - 1) * span + k] = detail::unitRoot<F>(r * k, span * radix);
+                if (radix != 2 && radix != 4)
+                    for (std::size_t t = 0; t < radix; ++t)
+                        st.roots.push_back(detail::unitRoot<F>(t, radix));
+                stages.push_back(std::move(st));
+                span *= radix;
+            }
+        }
+
+        /// Transform size.
+        std::size_t size() const { return n; }
+
+        /// Radices of the stages, in execution order.
+        std::vector<std::size_t> radices() const
+        {
+            std::vector<std::size_t> r;
+            for (const auto &st : stages)
+                r.push_back(st.radix);
+            return r;
+        }
+
+        /**
+         * @brief Forward transform, X[k] = sum x[j] e^(-2 pi i jk / n).
+         * @param in Input, n values.
+         * @param out Output, n values; may be in for an in-place transform.
+         */
+        void forward(const C *in, C *out) const { run<false>(in, out); }
+
+        /**
+         * @brief Inverse transform scaled by 1/n, so inverse(forward(x)) == x.
+         * @param in Input, n values.
+         * @param out Output, n values; may be in for an in-place transform.
+         */
+        void inverse(const C *in, C *out) const { run<true>(in, out); }
+
+        void forward(C *data) const { run<false>(data, data); }
+        void inverse(C *data) const { run<true>(data, data); }
+    };
+
+    /**
+     * @brief FFT plan for real input of one size: a complex plan of half the size
+     *        plus the twiddles that split its output into the real spectrum.
+     *
+     * @tparam F float or double.
+     */
+    template <typename F>
+    class RealFftPlan
+    {
+    private:
+        using C = Complex<F, F>;
+
+        std::size_t n;
+        std::unique_ptr<FftPlan<F>> half; ///< Size n/2 for even n, n for odd n
+        std::vector<C> twiddles;          ///< e^(-2 pi i k / n), k < n/2
+
+    public:
+        /**
+         * @param n Number of real samples, at least 1.
+         * @throws std::runtime_error if n is 0.
+         */
+        explicit RealFftPlan(std::size_t n) : n(n)
+        {
+            if (n == 0)
+                throw(std::runtime_error("FFT size must be positive"));
+            bool even = n % 2 == 0;
+            half = std::make_unique<FftPlan<F>>(even ? n / 2 : n);
+            if (even)
+                for (std::size_t k = 0; k < n / 2; ++k)
+                    twiddles.push_back(detail::unitRoot<F>(k, n));
+        }
+
+        /// Number of real samples.
+        std::size_t size() const { return n; }
+
+        /// Number of spectrum bins, n/2 + 1.
+        std::size_t bins() const { return n / 2 + 1; }
+
+        /**
+         * @brief Spectrum of n real samples: bins 0..n/2 of the complex FFT.
+         * @param in n real samples.
+         * @param out n/2 + 1 bins.
+         */
+        void forward(const F *in, C *out) const
+        {
+            if (n % 2)
+            {
+                // Odd sizes have no half-size split; run the full complex transform
+                std::vector<C> buf(n);
+                for (std::size_t i = 0; i < n; ++i)
+                    buf[i] = C(in[i], 0);
+                half->forward(buf.data());
+                std::copy(buf.begin(), buf.begin() + bins(), out);
+                return;
+            }
+            // Even and odd samples as one complex signal of length h, reinterpreted in place
+            const std::size_t h = n / 2;
+            half->forward(reinterpret_cast<const C *>(in), out);
+            F r0 = out[0].getReal(), i0 = out[0].getImg();
+            out[0] = C(r0 + i0, 0);
+            out[h] = C(r0 - i0, 0);
+            for (std::size_t k = 1; 2 * k <= h; ++k)
+            {
+                std::size_t j = h - k;
+                C zk = out[k], zj = out[j];
+                // Ze = (Z[k] + conj(Z[j])) / 2, Zo = -i (Z[k] - conj(Z[j])) / 2
+                C ze(F(0.5) * (zk.getReal() + zj.getReal()), F(0.5) * (zk.getImg() - zj.getImg()));
+                C zo(F(0.5) * (zk.getImg() + zj.getImg()), F(0.5) * (zj.getReal() - zk.getReal()));
+                C t = detail::twiddleMul<false>(zo, twiddles[k]);
+                out[k] = ze + t;
+                if (j != k)
+                {
+                    // X[j] = conj(Ze) + w^j conj(Zo) = conj(Ze - w^k Zo)
+                    C u = ze - t;
+                    out[j] = C(u.getReal(), -u.getImg());
+                }
+            }
+        }
+
+        /**
+         * @brief Real samples from a spectrum produced by forward(), scaled by 1/n.
+         * @param in n/2 + 1 bins.
+         * @param out n real samples.
+         */
+        void inverse(const C *in, F *out) const
+        {
+            if (n % 2)
+            {
+                // Rebuild the Hermitian-symmetric full spectrum
+                std::vector<C> full(in, in + bins());
+                full.resize(n);
+                for (std::size_t k = bins(); k < n; ++k)
+                    full[k] = C(in[n - k].getReal(), -in[n - k].getImg());
+                half->inverse(full.data());
+                for (std::size_t i = 0; i < n; ++i)
+                    out[i] = full[i].getReal();
+                return;
+            }
+            const std::size_t h = n / 2;
+            C *z = reinterpret_cast<C *>(out);
+            for (std::size_t k = 0; 2 * k <= h; ++k)
+            {
+                std::size_t j = h - k;
+                C xk = in[k], xj = in[j];
+                // Ze = (X[k] + conj(X[j])) / 2, Zo = (X[k] - conj(X[j])) conj(w^k) / 2, Z = Ze + i Zo
+                C ze(F(0.5) * (xk.getReal() + xj.getReal()), F(0.5) * (xk.getImg() - xj.getImg()));
+                C d(F(0.5) * (xk.getReal() - xj.getReal()), F(0.5) * (xk.getImg() + xj.getImg()));
+                C zo = detail::twiddleMul<true>(d, twiddles[k]);
+                z[k] = C(ze.getReal() - zo.getImg(), ze.getImg() + zo.getReal());
+                if (j != k && j < h)
+                    // The mirrored bin: Ze and Zo of j are the conjugates of those of k
+                    z[j] = C(ze.getReal() + zo.getImg(), -ze.getImg() + zo.getReal());
+            }
+            half->inverse(z, z);
+        }
+    };
+
+    namespace detail
+    {
+        /// Process-wide cache of plans by size; plans are never evicted.
+        template <typename Plan>
+        const Plan &cachedPlan(std::size_t n)
+        {
+            static std::mutex m;
+            static std::unordered_map<std::size_t, std::unique_ptr<Plan>> plans;
+            std::lock_guard<std::mutex> lock(m);
+            auto &slot = plans[n];
+            if (!slot)
+                slot = std::make_unique<Plan>(n);
+            return *slot;
+        }
+    }
+
+    /**
+     * @brief Cached complex FFT plan for size n, built on first use.
+     * @throws std::runtime_error if n is 0.
+     */
+    template <typename F>
+    const FftPlan<F> &fftPlan(std::size_t n)
+    {
+        return detail::cachedPlan<FftPlan<F>>(n);
+    }
+
+    /**
+     * @brief Cached real-input FFT plan for n samples, built on first use.
+     * @throws std::runtime_error if n is 0.
+     */
+    template <typename F>
+    const RealFftPlan<F> &realFftPlan(std::size_t n)
+    {
+        return detail::cachedPlan<RealFftPlan<F>>(n);
+    }
+
+    // =========================
+    // Convenience Functions
+    // =========================
+
+    /// Forward FFT of n values from in to out (may be equal), using the cached plan.
+    template <typename F>
+    void fft(const Complex<F, F> *in, Complex<F, F> *out, std::size_t n)
+    {
+        fftPlan<F>(n).forward(in, out);
+    }
+
+    /// In-place forward FFT of n values.
+    template <typename F>
+    void fft(Complex<F, F> *data, std::size_t n)
+    {
+        fftPlan<F>(n).forward(data);
+    }
+
+    /// Inverse FFT scaled by 1/n, from in to out (may be equal).
+    template <typename F>
+    void ifft(const Complex<F, F> *in, Complex<F, F> *out, std::size_t n)
+    {
+        fftPlan<F>(n).inverse(in, out);
+    }
+
+    /// In-place inverse FFT scaled by 1/n.
+    template <typename F>
+    void ifft(Complex<F, F> *data, std::size_t n)
+    {
+        fftPlan<F>(n).inverse(data);
+    }
+
+    /// Spectrum of n real samples into n/2 + 1 bins.
+    template <typename F>
+    void rfft(const F *in, Complex<F, F> *out, std::size_t n)
+    {
+        realFftPlan<F>(n).forward(in, out);
+    }
+
+    /// n real samples from n/2 + 1 bins, scaled by 1/n.
+    template <typename F>
+    void irfft(const Complex<F, F> *in, F *out, std::size_t n)
+    {
+        realFftPlan<F>(n).inverse(in, out);
+    }
+}
@@ -0,0 +1,180 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @file Fixed.hpp
+ * @brief Saturating signed fixed-point numbers in Q format (Q15, Q31).
+ *
+ * A Fixed<Raw, FRAC> stores value * 2^FRAC rounded to the nearest Raw, so Q15
+ * (int16_t, 15 fraction bits) and Q31 (int32_t, 31 fraction bits) cover
+ * [-1, 1) with a resolution of 2^-15 and 2^-31. Arithmetic saturates at the
+ * ends of the range instead of wrapping, as DSP hardware does; products and
+ * quotients are rounded to nearest.
+ *
+ * The operators are branch-free integer code on the raw values, so loops over
+ * Q15 arrays vectorize to 16-bit lanes: twice as many per register as float
+ * and four times as many as double.
+ */
+
+namespace myStd
+{
+    /**
+     * @brief Signed fixed-point number with FRAC fraction bits stored in Raw.
+     *
+     * @tparam Raw Signed integer storage type (int16_t for Q15, int32_t for Q31).
+     * @tparam FRAC Number of fraction bits, at most the value bits of Raw.
+     */
+    template <typename Raw, int FRAC>
+    class Fixed
+    {
+        static_assert(std::is_integral_v<Raw> && std::is_signed_v<Raw>, "Fixed needs a signed integer storage type");
+        static_assert(FRAC > 0 && FRAC < static_cast<int>(sizeof(Raw) * 8), "FRAC must leave room for the sign bit");
+
+    private:
+        /// Integer type wide enough for a sum or product of two raw values.
+        using Wide = std::conditional_t<(sizeof(Raw) < 4), std::int32_t, std::int64_t>;
+
+        static constexpr Wide RAW_MIN = std::numeric_limits<Raw>::min();
+        static constexpr Wide RAW_MAX = std::numeric_limits<Raw>::max();
+        static constexpr Wide ONE = Wide(1) << FRAC;
+
+        Raw bits = 0;
+
+        static constexpr Raw saturate(Wide v) noexcept
+        {
+            return static_cast<Raw>(std::min(std::max(v, RAW_MIN), RAW_MAX));
+        }
+
+        /// Rounds v * 2^FRAC to the nearest raw value, saturating; NaN maps to 0.
+        static constexpr Raw fromFloating(double v) noexcept
+        {
+            double s = v * static_cast<double>(ONE);
+            if (!(s == s))
+                return 0;
+            s = std::min(std::max(s, static_cast<double>(RAW_MIN)), static_cast<double>(RAW_MAX));
+            return static_cast<Raw>(s < 0 ? s - 0.5 : s + 0.5);
+        }
+
+    public:
+        using raw_type = Raw;
+        static constexpr int fraction_bits = FRAC;
+
+        constexpr Fixed() = default;
+
+        /**
+         * @brief Converts an arithmetic value, rounding to nearest and saturating.
+         */
+        template <typename A, typename = std::enable_if_t<std::is_arithmetic_v<A>>>
+        constexpr explicit Fixed(A v) noexcept : bits(fromFloating(static_cast<double>(v)))
+        {
+        }
+
+        /**
+         * @brief Converts from another Q format, saturating when narrowing the range.
+         */
+        template <typename R2, int F2>
+        constexpr explicit Fixed(Fixed<R2, F2> v) noexcept
+        {
+            using W = std::common_type_t<Wide, typename Fixed<R2, F2>::Wide>;
+            W r = v.raw();
+            if constexpr (F2 < FRAC)
+                r *= W(1) << (FRAC - F2);
+            else if constexpr (F2 > FRAC)
+                r >>= (F2 - FRAC);
+            bits = static_cast<Raw>(std::min<W>(std::max<W>(r, RAW_MIN), RAW_MAX));
+        }
+
+        /// Value with the given raw representation.
+        static constexpr Fixed fromRaw(Raw r) noexcept
+        {
+            Fixed f;
+            f.bits = r;
+            return f;
+        }
+
+        /// Raw representation, value * 2^FRAC.
+        constexpr Raw raw() const noexcept { return bits; }
+
+        /// Smallest and largest representable values.
+        static constexpr Fixed lowest() noexcept { return fromRaw(std::numeric_limits<Raw>::min()); }
+        static constexpr Fixed highest() noexcept { return fromRaw(std::numeric_limits<Raw>::max()); }
+
+        constexpr explicit operator double() const noexcept { return static_cast<double>(bits) / static_cast<double>(ONE); }
+        constexpr explicit operator float() const noexcept { return static_cast<float>(bits) / static_cast<float>(ONE); }
+
+        // =========================
+        // Arithmetic Operators
+        // =========================
+
+        constexpr Fixed operator+(Fixed o) const noexcept { return fromRaw(saturate(Wide(bits) + o.bits)); }
+        constexpr Fixed operator-(Fixed o) const noexcept { return fromRaw(saturate(Wide(bits) - o.bits)); }
+        constexpr Fixed operator-() const noexcept { return fromRaw(saturate(-Wide(bits))); }
+
+        /// Product rounded to nearest; only lowest() * lowest() saturates.
+        constexpr Fixed operator*(Fixed o) const noexcept
+        {
+            return fromRaw(saturate((Wide(bits) * o.bits + (Wide(1) << (FRAC - 1))) >> FRAC));
+        }
+
+        /// Quotient rounded to nearest, ties away from zero; saturates when it is outside [-1, 1), and on division by zero.
+        constexpr Fixed operator/(Fixed o) const noexcept
+        {
+            if (o.bits == 0)
+                return bits < 0 ? lowest() : highest();
+            Wide n = Wide(bits) * ONE, half = (o.bits < 0 ? -Wide(o.bits) : Wide(o.bits)) / 2;
+            return fromRaw(saturate((n < 0 ? n - half : n + half) / o.bits));
+        }
+
+        constexpr Fixed &operator+=(Fixed o) noexcept { return *this = *this + o; }
+        constexpr Fixed &operator-=(Fixed o) noexcept { return *this = *this - o; }
+        constexpr Fixed &operator*=(Fixed o) noexcept { return *this = *this * o; }
+        constexpr Fixed &operator/=(Fixed o) noexcept { return *this = *this / o; }
+
+        // =========================
+        // Comparison Operators
+        // =========================
+
+        constexpr bool operator==(Fixed o) const noexcept { return bits == o.bits; }
+        constexpr bool operator!=(Fixed o) const noexcept { return bits != o.bits; }
+        constexpr bool operator<(Fixed o) const noexcept { return bits < o.bits; }
+        constexpr bool operator>(Fixed o) const noexcept { return bits > o.bits; }
+        constexpr bool operator<=(Fixed o) const noexcept { return bits <= o.bits; }
+        constexpr bool operator>=(Fixed o) const noexcept { return bits >= o.bits; }
+
+        // =========================
+        // I/O Operators
+        // =========================
+
+        /**
+         * @brief Prints the value in decimal, e.g. 0.5.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const Fixed &f)
+        {
+            return os << static_cast<double>(f);
+        }
+
+        /**
+         * @brief Reads a decimal value, saturating to the representable range.
+         */
+        friend std::istream &operator>>(std::istream &is, Fixed &f)
+        {
+            double v;
+            if (is >> v)
+                f = Fixed(v);
+            return is;
+        }
+
+        template <typename, int>
+        friend class Fixed;
+    };
+
+    /// 16-bit fixed point with 15 fraction bits, range [-1, 1).
+    using Q15 = Fixed<std::int16_t, 15>;
+
+    /// 32-bit fixed point with 31 fraction bits, range [-1, 1).
+    using Q31 = Fixed<std::int32_t, 31>;
+}
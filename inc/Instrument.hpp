@@ -0,0 +1,334 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+#include "Utils.hpp"
+#include "Arena.hpp"
+#include "TypeTag.hpp"
+
+/**
+ * @file Instrument.hpp
+ * @brief Opt-in operation counters and latency sampling for Type<T>'s operators.
+ *
+ * Compiled in only when MYSTD_INSTRUMENT is defined; otherwise every hook is an
+ * empty inline function and no counter storage exists. When enabled, each
+ * operator counts its (lhs type, rhs type, operator) triple, the events below,
+ * and times one call in every MYSTD_INSTRUMENT_SAMPLE calls per thread:
+ *
+ * @code
+ * // g++ -DMYSTD_INSTRUMENT ...
+ * auto r = *a + *b;
+ * instrument::snapshot().dump(std::cout);
+ * @endcode
+ *
+ * Counters are shared relaxed atomics, so totals are exact but a snapshot taken
+ * while other threads are operating is not a single point in time.
+ */
+
+#ifndef MYSTD_INSTRUMENT_SAMPLE
+/// One call in this many is timed on each thread; 0 disables latency sampling.
+#define MYSTD_INSTRUMENT_SAMPLE 1024
+#endif
+
+namespace myStd
+{
+    namespace instrument
+    {
+#if defined(MYSTD_INSTRUMENT)
+        inline constexpr bool enabled = true;
+#else
+        inline constexpr bool enabled = false;
+#endif
+
+        /**
+         * @brief Instrumented operators.
+         */
+        enum class Op : unsigned char
+        {
+            Add,
+            Sub,
+            Mul,
+            Div,
+            AddAssign,
+            SubAssign,
+            MulAssign,
+            DivAssign,
+            Less,
+            Greater,
+            Equal,
+            Count
+        };
+
+        /**
+         * @brief Notable events on the operator paths.
+         */
+        enum class Event : unsigned char
+        {
+            Promotion,       ///< Arithmetic between operands of different types
+            CastFailure,     ///< dynamic_cast returned nullptr on the untagged fallback path
+            ComplexFallback, ///< A complex operand was reduced to its magnitude as a double
+            ComplexError,    ///< "Can't do this operation for complex numbers" was thrown
+            Count
+        };
+
+        constexpr std::size_t OPS = static_cast<std::size_t>(Op::Count);
+        constexpr std::size_t EVENTS = static_cast<std::size_t>(Event::Count);
+
+        /// Counter slots per operand: one per tagged type plus one for untagged types.
+        constexpr std::size_t SLOTS = NumericTypes::size + 1;
+
+        /// Counter slot of a tag.
+        constexpr std::size_t slot(TypeTag tag) noexcept
+        {
+            return tag == noTag ? NumericTypes::size : tag;
+        }
+
+        namespace detail
+        {
+            template <typename... Ts>
+            constexpr std::array<bool, sizeof...(Ts)> complexTags(TypeList<Ts...>)
+            {
+                return {{is_complex<Ts>::value...}};
+            }
+
+            inline constexpr auto complexTagTable = complexTags(NumericTypes{});
+        }
+
+        /// true if tag identifies a Complex instantiation.
+        constexpr bool isComplexTag(TypeTag tag) noexcept
+        {
+            return tag != noTag && detail::complexTagTable[tag];
+        }
+
+        /// Display name of a counter slot.
+        inline const char *slotName(std::size_t s)
+        {
+            static const char *names[] = {"int", "double",
+                                          "Complex<int,int>", "Complex<double,double>",
+                                          "Complex<int,double>", "Complex<double,int>",
+                                          "float", "Complex<float,float>", "Q15", "Q31",
+                                          "PolarComplex<double>", "PolarComplex<float>", "BigInt",
+                                          "untagged"};
+            static_assert(sizeof(names) / sizeof(names[0]) == SLOTS, "Name every type in NumericTypes");
+            return names[s];
+        }
+
+        /// Display name of an operator.
+        inline const char *opName(Op op)
+        {
+            static const char *names[] = {"+", "-", "*", "/", "+=", "-=", "*=", "/=", "<", ">", "=="};
+            return names[static_cast<std::size_t>(op)];
+        }
+
+        /// Display name of an event.
+        inline const char *eventName(Event e)
+        {
+            static const char *names[] = {"promotion", "cast failure", "complex->double fallback", "complex error"};
+            return names[static_cast<std::size_t>(e)];
+        }
+
+        /**
+         * @brief Sampled latency of one operator.
+         */
+        struct Latency
+        {
+            std::uint64_t samples = 0;
+            std::uint64_t totalNs = 0;
+            std::uint64_t maxNs = 0;
+
+            double meanNs() const { return samples ? static_cast<double>(totalNs) / static_cast<double>(samples) : 0.0; }
+        };
+
+        /**
+         * @brief Copy of all counters at one moment.
+         */
+        struct Snapshot
+        {
+            std::uint64_t ops[SLOTS][SLOTS][OPS] = {};
+            std::uint64_t events[EVENTS] = {};
+            Latency latency[OPS];
+            AllocStats allocations{0, 0};
+
+            /// Number of calls of an operator over all type pairs.
+            std::uint64_t total(Op op) const
+            {
+                std::uint64_t sum = 0;
+                for (std::size_t l = 0; l < SLOTS; ++l)
+                    for (std::size_t r = 0; r < SLOTS; ++r)
+                        sum += ops[l][r][static_cast<std::size_t>(op)];
+                return sum;
+            }
+
+            /// Number of occurrences of an event.
+            std::uint64_t count(Event e) const { return events[static_cast<std::size_t>(e)]; }
+
+            /**
+             * @brief Writes the non-zero counters as a readable table.
+             * @param os Output stream.
+             */
+            void dump(std::ostream &os) const
+            {
+                os << "operations (lhs op rhs: calls)\n";
+                for (std::size_t l = 0; l < SLOTS; ++l)
+                    for (std::size_t r = 0; r < SLOTS; ++r)
+                        for (std::size_t o = 0; o < OPS; ++o)
+                            if (ops[l][r][o])
+                                os << "  " << slotName(l) << " " << opName(static_cast<Op>(o)) << " " << slotName(r)
+                                   << ": " << ops[l][r][o] << "\n";
+                os << "events\n";
+                for (std::size_t e = 0; e < EVENTS; ++e)
+                    os << "  " << eventName(static_cast<Event>(e)) << ": " << events[e] << "\n";
+                os << "sampled latency (1 in " << MYSTD_INSTRUMENT_SAMPLE << ")\n";
+                for (std::size_t o = 0; o < OPS; ++o)
+                    if (latency[o].samples)
+                        os << "  " << opName(static_cast<Op>(o)) << ": " << latency[o].samples << " samples, mean "
+                           << std::fixed << std::setprecision(1) << latency[o].meanNs() << " ns, max "
+                           << latency[o].maxNs << " ns\n";
+                os << "Numeric allocations: " << allocations.heap << " heap, " << allocations.arena << " arena"
+                   << std::endl;
+            }
+        };
+
+#if defined(MYSTD_INSTRUMENT)
+        namespace detail
+        {
+            struct AtomicLatency
+            {
+                std::atomic<std::uint64_t> samples{0};
+                std::atomic<std::uint64_t> totalNs{0};
+                std::atomic<std::uint64_t> maxNs{0};
+            };
+
+            inline std::atomic<std::uint64_t> opCounters[SLOTS][SLOTS][OPS];
+            inline std::atomic<std::uint64_t> eventCounters[EVENTS];
+            inline AtomicLatency latencies[OPS];
+
+            /// Calls left on this thread until the next timed one.
+            inline thread_local std::uint32_t untilSample = 0;
+        }
+#endif
+
+        /**
+         * @brief Counts an event.
+         */
+        inline void count(Event e) noexcept
+        {
+#if defined(MYSTD_INSTRUMENT)
+            detail::eventCounters[static_cast<std::size_t>(e)].fetch_add(1, std::memory_order_relaxed);
+#else
+            (void)e;
+#endif
+        }
+
+        /**
+         * @brief Counts ComplexFallback if the operand with this tag is complex.
+         */
+        inline void countComplexFallback(TypeTag operand) noexcept
+        {
+            if constexpr (enabled)
+                if (isComplexTag(operand))
+                    count(Event::ComplexFallback);
+            (void)operand;
+        }
+
+        /**
+         * @brief Scope guard placed at the top of an operator: counts the call and,
+         *        for sampled calls, records the time until the scope ends.
+         */
+        class Probe
+        {
+#if defined(MYSTD_INSTRUMENT)
+        private:
+            Op op;
+            bool timed = false;
+            std::chrono::steady_clock::time_point start;
+
+        public:
+            Probe(Op op, TypeTag lhs, TypeTag rhs) noexcept : op(op)
+            {
+                auto o = static_cast<std::size_t>(op);
+                detail::opCounters[slot(lhs)][slot(rhs)][o].fetch_add(1, std::memory_order_relaxed);
+                if (lhs != rhs && op < Op::Less)
+                    count(Event::Promotion);
+                if (MYSTD_INSTRUMENT_SAMPLE > 0 && detail::untilSample-- == 0)
+                {
+                    detail::untilSample = MYSTD_INSTRUMENT_SAMPLE - 1;
+                    timed = true;
+                    start = std::chrono::steady_clock::now();
+                }
+            }
+
+            ~Probe()
+            {
+                if (!timed)
+                    return;
+                auto ns = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+                auto &l = detail::latencies[static_cast<std::size_t>(op)];
+                l.samples.fetch_add(1, std::memory_order_relaxed);
+                l.totalNs.fetch_add(ns, std::memory_order_relaxed);
+                std::uint64_t prev = l.maxNs.load(std::memory_order_relaxed);
+                while (prev < ns && !l.maxNs.compare_exchange_weak(prev, ns, std::memory_order_relaxed))
+                {
+                }
+            }
+#else
+        public:
+            constexpr Probe(Op, TypeTag, TypeTag) noexcept {}
+#endif
+            Probe(const Probe &) = delete;
+            Probe &operator=(const Probe &) = delete;
+        };
+
+        /**
+         * @brief Returns a copy of all counters. All zero unless MYSTD_INSTRUMENT is defined.
+         */
+        inline Snapshot snapshot()
+        {
+            Snapshot s;
+#if defined(MYSTD_INSTRUMENT)
+            for (std::size_t l = 0; l < SLOTS; ++l)
+                for (std::size_t r = 0; r < SLOTS; ++r)
+                    for (std::size_t o = 0; o < OPS; ++o)
+                        s.ops[l][r][o] = detail::opCounters[l][r][o].load(std::memory_order_relaxed);
+            for (std::size_t e = 0; e < EVENTS; ++e)
+                s.events[e] = detail::eventCounters[e].load(std::memory_order_relaxed);
+            for (std::size_t o = 0; o < OPS; ++o)
+            {
+                s.latency[o].samples = detail::latencies[o].samples.load(std::memory_order_relaxed);
+                s.latency[o].totalNs = detail::latencies[o].totalNs.load(std::memory_order_relaxed);
+                s.latency[o].maxNs = detail::latencies[o].maxNs.load(std::memory_order_relaxed);
+            }
+            s.allocations = allocStats();
+#endif
+            return s;
+        }
+
+        /**
+         * @brief Sets every counter to zero, including allocStats().
+         */
+        inline void reset()
+        {
+#if defined(MYSTD_INSTRUMENT)
+            for (auto &row : detail::opCounters)
+                for (auto &cell : row)
+                    for (auto &c : cell)
+                        c.store(0, std::memory_order_relaxed);
+            for (auto &c : detail::eventCounters)
+                c.store(0, std::memory_order_relaxed);
+            for (auto &l : detail::latencies)
+            {
+                l.samples.store(0, std::memory_order_relaxed);
+                l.totalNs.store(0, std::memory_order_relaxed);
+                l.maxNs.store(0, std::memory_order_relaxed);
+            }
+            resetAllocStats();
+#endif
+        }
+    }
+}
@@ -0,0 +1,642 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "Parallel.hpp"
+#include "Reduce.hpp"
+#include "Type.hpp"
+
+/**
+ * @file Matrix.hpp
+ * @brief Dense row-major matrices with a cache-blocked GEMM, matrix-vector
+ *        product and transpose, run sequentially or on a ThreadPool.
+ *
+ * @code
+ * Matrix<double> a(512, 256, 1.0), b(256, 128, 2.0), c(512, 128);
+ * gemm(a, b, c);                         // c = a * b
+ * gemm(Parallel{}, a, b, c, 2.0, 1.0);   // c = 2 a b + c on the global pool
+ * Matrix<double> t = transpose(a);
+ * @endcode
+ *
+ * GEMM follows the usual Goto/BLIS layout. C is cut into MC x NC tiles; for
+ * each KC-deep slice of the inner dimension the tile's rows of A are packed
+ * into MR-row panels and its columns of B into NR-column panels, so the
+ * micro-kernel reads both with unit stride and the A block stays in L2 while
+ * one B panel stays in L1. The micro-kernel keeps an MR x NR block of C in
+ * registers: with AVX it is 6 x 8 for double and 6 x 16 for float, twelve
+ * vector accumulators updated by fused multiply-adds. Other element types use
+ * a portable 4 x 4 kernel the compiler vectorizes as it can.
+ *
+ * Complex products run as four real GEMMs on split real and imaginary planes
+ * (Cr = Ar Br - Ai Bi, Ci = Ar Bi + Ai Br), so they use the same vector kernel
+ * at the same 8 m n k flop count as a direct complex GEMM.
+ *
+ * With a Parallel policy the tiles of C are independent tasks on the pool;
+ * every task packs its own panels into per-thread buffers. Results are the
+ * same as with Sequential, since each element is summed in the same order.
+ */
+
+namespace myStd
+{
+    namespace detail
+    {
+        /// Multiplicative identity: 1, or 1 + 0i for complex T.
+        template <typename T>
+        constexpr T unitOf()
+        {
+            if constexpr (is_complex_v<T>)
+                return T(1, 0);
+            else
+                return T(1);
+        }
+    }
+
+    /**
+     * @brief Dense matrix with row-major contiguous storage.
+     *
+     * @tparam T Arithmetic type or Complex<F, F> with floating-point F.
+     */
+    template <typename T>
+    class Matrix
+    {
+        static_assert(std::is_arithmetic_v<T> || is_complex_v<T>, "Matrix needs an arithmetic or complex element type");
+
+    private:
+        std::size_t nRows = 0;
+        std::size_t nCols = 0;
+        std::vector<T> data;
+
+    public:
+        using value_type = T;
+
+        // =========================
+        // Constructors
+        // =========================
+
+        /**
+         * @brief Default constructor. Creates a 0 x 0 matrix.
+         */
+        Matrix() = default;
+
+        /**
+         * @brief Construct a rows x cols matrix filled with a value.
+         */
+        Matrix(std::size_t rows, std::size_t cols, T val = T{}) : nRows(rows), nCols(cols), data(rows * cols, val) {}
+
+        /**
+         * @brief Construct from nested lists, one per row.
+         * @throws std::runtime_error if the rows differ in length.
+         */
+        Matrix(std::initializer_list<std::initializer_list<T>> values) : nRows(values.size()), nCols(values.size() ? values.begin()->size() : 0)
+        {
+            data.reserve(nRows * nCols);
+            for (const auto &row : values)
+            {
+                if (row.size() != nCols)
+                    throw(std::runtime_error("Ragged matrix rows!"));
+                data.insert(data.end(), row.begin(), row.end());
+            }
+        }
+
+        /**
+         * @brief Returns the n x n identity matrix.
+         */
+        static Matrix identity(std::size_t n)
+        {
+            Matrix m(n, n);
+            for (std::size_t i = 0; i < n; ++i)
+                m(i, i) = detail::unitOf<T>();
+            return m;
+        }
+
+        /**
+         * @brief Builds a rows x cols matrix from row-major Type<T> values.
+         * @param values rows * cols values.
+         */
+        static Matrix fromTypes(std::size_t rows, std::size_t cols, const Type<T> *values)
+        {
+            Matrix m(rows, cols);
+            for (std::size_t i = 0; i < rows * cols; ++i)
+                m.data[i] = values[i].get();
+            return m;
+        }
+
+        // =========================
+        // Element Access
+        // =========================
+
+        std::size_t rows() const { return nRows; }
+        std::size_t cols() const { return nCols; }
+
+        /**
+         * @brief Returns the number of elements, rows() * cols().
+         */
+        std::size_t size() const { return data.size(); }
+
+        T &operator()(std::size_t i, std::size_t j) { return data[i * nCols + j]; }
+        const T &operator()(std::size_t i, std::size_t j) const { return data[i * nCols + j]; }
+
+        /**
+         * @brief Returns a pointer to the first element of row i.
+         */
+        T *row(std::size_t i) { return data.data() + i * nCols; }
+        const T *row(std::size_t i) const { return data.data() + i * nCols; }
+
+        /**
+         * @brief Returns a pointer to the contiguous row-major storage.
+         */
+        T *raw() { return data.data(); }
+        const T *raw() const { return data.data(); }
+
+        // =========================
+        // Element-wise Operators
+        // =========================
+
+        /**
+         * @brief Element-wise sum.
+         * @throws std::runtime_error on shape mismatch.
+         */
+        Matrix operator+(const Matrix &o) const
+        {
+            checkShape(o);
+            Matrix r(nRows, nCols);
+            for (std::size_t i = 0; i < data.size(); ++i)
+                r.data[i] = data[i] + o.data[i];
+            return r;
+        }
+
+        /**
+         * @brief Element-wise difference.
+         * @throws std::runtime_error on shape mismatch.
+         */
+        Matrix operator-(const Matrix &o) const
+        {
+            checkShape(o);
+            Matrix r(nRows, nCols);
+            for (std::size_t i = 0; i < data.size(); ++i)
+                r.data[i] = data[i] - o.data[i];
+            return r;
+        }
+
+        /**
+         * @brief Multiplies every element by a scalar.
+         */
+        Matrix operator*(T s) const
+        {
+            Matrix r(nRows, nCols);
+            for (std::size_t i = 0; i < data.size(); ++i)
+                r.data[i] = data[i] * s;
+            return r;
+        }
+
+        bool operator==(const Matrix &o) const { return nRows == o.nRows && nCols == o.nCols && data == o.data; }
+        bool operator!=(const Matrix &o) const { return !(*this == o); }
+
+        // =========================
+        // I/O Operators
+        // =========================
+
+        /**
+         * @brief Prints one row per line, elements separated by spaces.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const Matrix &m)
+        {
+            for (std::size_t i = 0; i < m.nRows; ++i)
+            {
+                for (std::size_t j = 0; j < m.nCols; ++j)
+                    os << (j ? " " : "") << m(i, j);
+                os << '\n';
+            }
+            return os;
+        }
+
+    private:
+        void checkShape(const Matrix &o) const
+        {
+            if (nRows != o.nRows || nCols != o.nCols)
+                throw(std::runtime_error("Size mismatch!"));
+        }
+    };
+
+    namespace detail
+    {
+        /// Depth of the packed slices of A and B.
+        constexpr std::size_t GEMM_KC = 256;
+        /// Rows of C per tile; a multiple of every MR.
+        constexpr std::size_t GEMM_MC = 96;
+        /// Columns of C per tile; a multiple of every NR.
+        constexpr std::size_t GEMM_NC = 512;
+
+        /// Register block of the micro-kernel: MR rows of A by NR columns of B.
+        template <typename T>
+        struct GemmTile
+        {
+            static constexpr std::size_t MR = 4;
+            static constexpr std::size_t NR = 4;
+        };
+
+        /// acc[MR][NR] = sum over p < kc of a[p][MR] (outer) b[p][NR].
+        template <typename T>
+        void microKernel(std::size_t kc, const T *a, const T *b, T *acc)
+        {
+            constexpr std::size_t MR = GemmTile<T>::MR, NR = GemmTile<T>::NR;
+            T c[MR * NR] = {};
+            for (std::size_t p = 0; p < kc; ++p, a += MR, b += NR)
+                for (std::size_t i = 0; i < MR; ++i)
+                    for (std::size_t j = 0; j < NR; ++j)
+                        c[i * NR + j] += a[i] * b[j];
+            std::copy(c, c + MR * NR, acc);
+        }
+
+#if defined(__AVX__)
+        template <>
+        struct GemmTile<double>
+        {
+            static constexpr std::size_t MR = 6;
+            static constexpr std::size_t NR = 8;
+        };
+
+        template <>
+        struct GemmTile<float>
+        {
+            static constexpr std::size_t MR = 6;
+            static constexpr std::size_t NR = 16;
+        };
+
+        inline __m256d fmadd(__m256d a, __m256d b, __m256d c)
+        {
+#if defined(__FMA__)
+            return _mm256_fmadd_pd(a, b, c);
+#else
+            return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+        }
+
+        inline __m256 fmadd(__m256 a, __m256 b, __m256 c)
+        {
+#if defined(__FMA__)
+            return _mm256_fmadd_ps(a, b, c);
+#else
+            return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+        }
+
+        /// 6 x 8 doubles: twelve ymm accumulators, two B loads and six broadcasts per step.
+        template <>
+        inline void microKernel<double>(std::size_t kc, const double *a, const double *b, double *acc)
+        {
+            __m256d c0[6], c1[6];
+            for (int i = 0; i < 6; ++i)
+                c0[i] = c1[i] = _mm256_setzero_pd();
+            for (std::size_t p = 0; p < kc; ++p, a += 6, b += 8)
+            {
+                __m256d b0 = _mm256_loadu_pd(b), b1 = _mm256_loadu_pd(b + 4);
+                for (int i = 0; i < 6; ++i)
+                {
+                    __m256d ai = _mm256_broadcast_sd(a + i);
+                    c0[i] = fmadd(ai, b0, c0[i]);
+                    c1[i] = fmadd(ai, b1, c1[i]);
+                }
+            }
+            for (int i = 0; i < 6; ++i)
+            {
+                _mm256_storeu_pd(acc + i * 8, c0[i]);
+                _mm256_storeu_pd(acc + i * 8 + 4, c1[i]);
+            }
+        }
+
+        /// 6 x 16 floats, same register shape as the double kernel.
+        template <>
+        inline void microKernel<float>(std::size_t kc, const float *a, const float *b, float *acc)
+        {
+            __m256 c0[6], c1[6];
+            for (int i = 0; i < 6; ++i)
+                c0[i] = c1[i] = _mm256_setzero_ps();
+            for (std::size_t p = 0; p < kc; ++p, a += 6, b += 16)
+            {
+                __m256 b0 = _mm256_loadu_ps(b), b1 = _mm256_loadu_ps(b + 8);
+                for (int i = 0; i < 6; ++i)
+                {
+                    __m256 ai = _mm256_broadcast_ss(a + i);
+                    c0[i] = fmadd(ai, b0, c0[i]);
+                    c1[i] = fmadd(ai, b1, c1[i]);
+                }
+            }
+            for (int i = 0; i < 6; ++i)
+            {
+                _mm256_storeu_ps(acc + i * 16, c0[i]);
+                _mm256_storeu_ps(acc + i * 16 + 8, c1[i]);
+            }
+        }
+#endif
+
+        /// Packs an mc x kc block of A into MR-row panels, k-major, zero-padding the last panel.
+        template <typename T>
+        void packA(const T *a, std::size_t lda, std::size_t mc, std::size_t kc, T *buf)
+        {
+            constexpr std::size_t MR = GemmTile<T>::MR;
+            for (std::size_t ir = 0; ir < mc; ir += MR)
+            {
+                std::size_t rows = std::min(MR, mc - ir);
+                for (std::size_t p = 0; p < kc; ++p)
+                {
+                    for (std::size_t i = 0; i < rows; ++i)
+                        *buf++ = a[(ir + i) * lda + p];
+                    for (std::size_t i = rows; i < MR; ++i)
+                        *buf++ = T{};
+                }
+            }
+        }
+
+        /// Packs a kc x nc block of B into NR-column panels, k-major, zero-padding the last panel.
+        template <typename T>
+        void packB(const T *b, std::size_t ldb, std::size_t kc, std::size_t nc, T *buf)
+        {
+            constexpr std::size_t NR = GemmTile<T>::NR;
+            for (std::size_t jr = 0; jr < nc; jr += NR)
+            {
+                std::size_t cols = std::min(NR, nc - jr);
+                for (std::size_t p = 0; p < kc; ++p)
+                {
+                    const T *src = b + p * ldb + jr;
+                    buf = std::copy(src, src + cols, buf);
+                    buf = std::fill_n(buf, NR - cols, T{});
+                }
+            }
+        }
+
+        /// C[i0, i1) x [j0, j1) = alpha A B + beta C over that tile.
+        template <typename T>
+        void gemmTile(std::size_t i0, std::size_t i1, std::size_t j0, std::size_t j1, std::size_t k,
+                      T alpha, const T *a, std::size_t lda, const T *b, std::size_t ldb,
+                      T beta, T *c, std::size_t ldc)
+        {
+            constexpr std::size_t MR = GemmTile<T>::MR, NR = GemmTile<T>::NR;
+            std::size_t mc = i1 - i0, nc = j1 - j0;
+
+            for (std::size_t i = i0; i < i1; ++i)
+            {
+                T *row = c + i * ldc;
+                if (beta == T{})
+                    std::fill(row + j0, row + j1, T{});
+                else if (beta != T(1))
+                    for (std::size_t j = j0; j < j1; ++j)
+                        row[j] *= beta;
+            }
+
+            thread_local std::vector<T> bufA, bufB;
+            bufA.resize(GEMM_MC * GEMM_KC);
+            bufB.resize(GEMM_KC * ((GEMM_NC + NR - 1) / NR * NR));
+            T acc[MR * NR];
+
+            for (std::size_t pc = 0; pc < k; pc += GEMM_KC)
+            {
+                std::size_t kc = std::min(GEMM_KC, k - pc);
+                packB(b + pc * ldb + j0, ldb, kc, nc, bufB.data());
+                packA(a + i0 * lda + pc, lda, mc, kc, bufA.data());
+                for (std::size_t jr = 0; jr < nc; jr += NR)
+                {
+                    std::size_t cols = std::min(NR, nc - jr);
+                    for (std::size_t ir = 0; ir < mc; ir += MR)
+                    {
+                        std::size_t rows = std::min(MR, mc - ir);
+                        microKernel(kc, bufA.data() + ir * kc, bufB.data() + jr * kc, acc);
+                        for (std::size_t i = 0; i < rows; ++i)
+                        {
+                            T *out = c + (i0 + ir + i) * ldc + j0 + jr;
+                            for (std::size_t j = 0; j < cols; ++j)
+                                out[j] += alpha * acc[i * NR + j];
+                        }
+                    }
+                }
+            }
+        }
+
+        /// C = alpha A B + beta C on raw row-major arrays; A is m x k, B is k x n.
+        template <typename Policy, typename T>
+        void gemmRaw(const Policy &policy, std::size_t m, std::size_t n, std::size_t k,
+                     T alpha, const T *a, std::size_t lda, const T *b, std::size_t ldb,
+                     T beta, T *c, std::size_t ldc)
+        {
+            std::size_t rowTiles = (m + GEMM_MC - 1) / GEMM_MC, colTiles = (n + GEMM_NC - 1) / GEMM_NC;
+            forBlocks(policy, rowTiles * colTiles, 1, [&](std::size_t begin, std::size_t end)
+                      {
+                for (std::size_t t = begin; t < end; ++t)
+                {
+                    std::size_t i0 = (t % rowTiles) * GEMM_MC, j0 = (t / rowTiles) * GEMM_NC;
+                    gemmTile(i0, std::min(m, i0 + GEMM_MC), j0, std::min(n, j0 + GEMM_NC), k,
+                             alpha, a, lda, b, ldb, beta, c, ldc);
+                } });
+        }
+
+        template <typename T>
+        void checkProduct(const Matrix<T> &a, const Matrix<T> &b, const Matrix<T> &c)
+        {
+            if (a.cols() != b.rows() || c.rows() != a.rows() || c.cols() != b.cols())
+                throw(std::runtime_error("Size mismatch!"));
+        }
+
+        /// Copies the real and imaginary parts of a complex matrix into two real ones.
+        template <typename F>
+        void splitPlanes(const Matrix<Complex<F, F>> &z, Matrix<F> &re, Matrix<F> &im)
+        {
+            re = Matrix<F>(z.rows(), z.cols());
+            im = Matrix<F>(z.rows(), z.cols());
+            const Complex<F, F> *src = z.raw();
+            for (std::size_t i = 0; i < z.size(); ++i)
+            {
+                re.raw()[i] = src[i].getReal();
+                im.raw()[i] = src[i].getImg();
+            }
+        }
+    }
+
+    // =========================
+    // Matrix Product
+    // =========================
+
+    /**
+     * @brief c = alpha a b + beta c.
+     * @param policy Sequential or Parallel.
+     * @param a m x k matrix.
+     * @param b k x n matrix.
+     * @param c m x n matrix; its old values are ignored when beta is 0.
+     * @throws std::runtime_error on shape mismatch.
+     */
+    template <typename Policy, typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    void gemm(const Policy &policy, const Matrix<T> &a, const Matrix<T> &b, Matrix<T> &c, T alpha = T(1), T beta = T{})
+    {
+        detail::checkProduct(a, b, c);
+        detail::gemmRaw(policy, a.rows(), b.cols(), a.cols(), alpha, a.raw(), a.cols(), b.raw(), b.cols(), beta, c.raw(), c.cols());
+    }
+
+    /**
+     * @brief c = alpha a b + beta c for complex matrices, as four real products.
+     * @throws std::runtime_error on shape mismatch.
+     */
+    template <typename Policy, typename F>
+    void gemm(const Policy &policy, const Matrix<Complex<F, F>> &a, const Matrix<Complex<F, F>> &b, Matrix<Complex<F, F>> &c,
+              Complex<F, F> alpha = Complex<F, F>(1, 0), Complex<F, F> beta = Complex<F, F>(0, 0))
+    {
+        static_assert(std::is_floating_point_v<F>, "complex gemm needs a floating-point component type");
+        detail::checkProduct(a, b, c);
+        std::size_t m = a.rows(), n = b.cols(), k = a.cols();
+        Matrix<F> ar, ai, br, bi, pr(m, n), pi(m, n);
+        detail::splitPlanes(a, ar, ai);
+        detail::splitPlanes(b, br, bi);
+        detail::gemmRaw(policy, m, n, k, F(1), ar.raw(), k, br.raw(), n, F(0), pr.raw(), n);
+        detail::gemmRaw(policy, m, n, k, F(-1), ai.raw(), k, bi.raw(), n, F(1), pr.raw(), n);
+        detail::gemmRaw(policy, m, n, k, F(1), ar.raw(), k, bi.raw(), n, F(0), pi.raw(), n);
+        detail::gemmRaw(policy, m, n, k, F(1), ai.raw(), k, br.raw(), n, F(1), pi.raw(), n);
+
+        F alr = alpha.getReal(), ali = alpha.getImg(), ber = beta.getReal(), bei = beta.getImg();
+        bool keep = ber != F(0) || bei != F(0);
+        Complex<F, F> *out = c.raw();
+        for (std::size_t i = 0; i < m * n; ++i)
+        {
+            F re = alr * pr.raw()[i] - ali * pi.raw()[i];
+            F im = alr * pi.raw()[i] + ali * pr.raw()[i];
+            if (keep)
+            {
+                F cr = out[i].getReal(), ci = out[i].getImg();
+                re += ber * cr - bei * ci;
+                im += ber * ci + bei * cr;
+            }
+            out[i] = Complex<F, F>(re, im);
+        }
+    }
+
+    /**
+     * @brief c = alpha a b + beta c on the calling thread.
+     */
+    template <typename T>
+    void gemm(const Matrix<T> &a, const Matrix<T> &b, Matrix<T> &c, T alpha = detail::unitOf<T>(), T beta = T{})
+    {
+        gemm(Sequential{}, a, b, c, alpha, beta);
+    }
+
+    /**
+     * @brief Matrix product a b.
+     * @throws std::runtime_error if a.cols() != b.rows().
+     */
+    template <typename T>
+    Matrix<T> operator*(const Matrix<T> &a, const Matrix<T> &b)
+    {
+        Matrix<T> c(a.rows(), b.cols());
+        gemm(a, b, c);
+        return c;
+    }
+
+    // =========================
+    // Matrix-Vector Product
+    // =========================
+
+    /**
+     * @brief y = alpha a x + beta y.
+     * @param policy Sequential or Parallel; rows are split into blocks.
+     * @param a m x n matrix.
+     * @param x n values.
+     * @param y m values; its old values are ignored when beta is 0.
+     */
+    template <typename Policy, typename T>
+    void gemv(const Policy &policy, const Matrix<T> &a, const T *x, T *y, T alpha = detail::unitOf<T>(), T beta = T{})
+    {
+        std::size_t n = a.cols();
+        std::size_t grain = std::max<std::size_t>(1, detail::grainFor<T>(policy) / std::max<std::size_t>(1, n));
+        detail::forBlocks(policy, a.rows(), grain, [&](std::size_t begin, std::size_t end)
+                          {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                T s{};
+                if constexpr (std::is_arithmetic_v<T>)
+                    s = dot(a.row(i), x, n);
+                else
+                    for (std::size_t j = 0; j < n; ++j)
+                        s = s + a(i, j) * x[j];
+                y[i] = beta == T{} ? alpha * s : alpha * s + beta * y[i];
+            } });
+    }
+
+    /**
+     * @brief y = alpha a x + beta y on the calling thread.
+     */
+    template <typename T>
+    void gemv(const Matrix<T> &a, const T *x, T *y, T alpha = detail::unitOf<T>(), T beta = T{})
+    {
+        gemv(Sequential{}, a, x, y, alpha, beta);
+    }
+
+    /**
+     * @brief Matrix-vector product a x.
+     * @throws std::runtime_error if x.size() != a.cols().
+     */
+    template <typename T>
+    std::vector<T> operator*(const Matrix<T> &a, const std::vector<T> &x)
+    {
+        if (x.size() != a.cols())
+            throw(std::runtime_error("Size mismatch!"));
+        std::vector<T> y(a.rows());
+        gemv(a, x.data(), y.data());
+        return y;
+    }
+
+    // =========================
+    // Transpose
+    // =========================
+
+    /**
+     * @brief t = transpose of a, copied in square tiles so reads and writes
+     *        both stay within a few cache lines per row.
+     * @param policy Sequential or Parallel; bands of rows of a run as blocks.
+     * @param t Output; reshaped to a.cols() x a.rows() if needed.
+     * @throws std::runtime_error if t is a.
+     */
+    template <typename Policy, typename T>
+    void transpose(const Policy &policy, const Matrix<T> &a, Matrix<T> &t)
+    {
+        constexpr std::size_t TILE = 32;
+        if (&a == &t)
+            throw(std::runtime_error("Cannot transpose a matrix into itself!"));
+        std::size_t m = a.rows(), n = a.cols();
+        if (t.rows() != n || t.cols() != m)
+            t = Matrix<T>(n, m);
+        detail::forBlocks(policy, (m + TILE - 1) / TILE, 1, [&](std::size_t begin, std::size_t end)
+                          {
+            for (std::size_t ib = begin * TILE; ib < std::min(m, end * TILE); ib += TILE)
+                for (std::size_t jb = 0; jb < n; jb += TILE)
+                    for (std::size_t j = jb; j < std::min(n, jb + TILE); ++j)
+                        for (std::size_t i = ib; i < std::min(m, ib + TILE); ++i)
+                            t(j, i) = a(i, j); });
+    }
+
+    /**
+     * @brief Returns the transpose of a.
+     */
+    template <typename Policy, typename T>
+    Matrix<T> transpose(const Policy &policy, const Matrix<T> &a)
+    {
+        Matrix<T> t(a.cols(), a.rows());
+        transpose(policy, a, t);
+        return t;
+    }
+
+    /**
+     * @brief Returns the transpose of a, on the calling thread.
+     */
+    template <typename T>
+    Matrix<T> transpose(const Matrix<T> &a)
+    {
+        return transpose(Sequential{}, a);
+    }
+}
@@ -1,6 +1,10 @@
 #pragma once
 #include <iostream>
 #include <memory>
+#include <new>
+
+#include "Arena.hpp"
+#include "TypeTag.hpp"
 
 namespace myStd
 {
@@ -12,7 +16,99 @@ namespace myStd
      */
     class Numeric
     {
+    protected:
+        // Tag of the concrete type (see TypeTag.hpp), used for dispatch without dynamic_cast
+        TypeTag tag = noTag;
+
+        /**
+         * @brief Default constructor. The object has no tag.
+         */
+        Numeric() = default;
+
+        /**
+         * @brief Construct with the tag of the concrete type.
+         * @param tag Tag of the derived type.
+         */
+        explicit Numeric(TypeTag tag) : tag(tag) {}
+
     public:
+        /**
+         * @brief Returns the tag of the concrete type.
+         * @return Tag, or noTag if the type is not in NumericTypes.
+         */
+        TypeTag getTag() const
+        {
+            return tag;
+        }
+
+        /**
+         * @brief Allocation functions. Objects are taken from the arena of the
+         *        active ArenaScope on this thread, or from the heap (see Arena.hpp).
+         */
+        static void *operator new(std::size_t size)
+        {
+            return detail::allocateNumeric(size);
+        }
+
+        static void operator delete(void *p) noexcept
+        {
+            detail::deallocateNumeric(p);
+        }
+
+        /// Placement forms, which the class-specific operator new would otherwise hide.
+        static void *operator new(std::size_t, void *where) noexcept
+        {
+            return where;
+        }
+
+        static void operator delete(void *, void *) noexcept {}
+
+        /// Non-throwing forms: nullptr instead of std::bad_alloc.
+        static void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+        {
+            try
+            {
+                return detail::allocateNumeric(size);
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+
+        static void operator delete(void *p, const std::nothrow_t &) noexcept
+        {
+            detail::deallocateNumeric(p);
+        }
+
+        /// Forms for over-aligned derived types; the arena or heap block is aligned to match.
+        static void *operator new(std::size_t size, std::align_val_t align)
+        {
+            return detail::allocateNumeric(size, static_cast<std::size_t>(align));
+        }
+
+        static void operator delete(void *p, std::align_val_t align) noexcept
+        {
+            detail::deallocateNumeric(p, static_cast<std::size_t>(align));
+        }
+
+        static void *operator new(std::size_t size, std::align_val_t align, const std::nothrow_t &) noexcept
+        {
+            try
+            {
+                return detail::allocateNumeric(size, static_cast<std::size_t>(align));
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+
+        static void operator delete(void *p, std::align_val_t align, const std::nothrow_t &) noexcept
+        {
+            detail::deallocateNumeric(p, static_cast<std::size_t>(align));
+        }
+
         /**
          * @brief Virtual destructor.
          *
@@ -0,0 +1,497 @@
+#pragma once
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "Simd.hpp"
+#include "ComplexMath.hpp"
+
+namespace myStd
+{
+    /**
+     * @brief Homogeneous, contiguous container of numeric values with element-wise kernels.
+     *
+     * Unlike std::vector<std::unique_ptr<Numeric>>, values are stored by value in a
+     * single array, so the element-wise operators stream through memory and are
+     * vectorized (see Simd.hpp).
+     *
+     * @tparam T Arithmetic or fixed-point element type (int, double, float, Q15, ...).
+     */
+    template <typename T>
+    class NumericVector
+    {
+        static_assert(std::is_arithmetic_v<T> || is_fixed_v<T>,
+                      "NumericVector<T> requires an arithmetic or fixed-point T, or Complex<F, F>");
+
+    private:
+        std::vector<T> data;
+
+        /**
+         * @brief Throws if the two vectors have different sizes.
+         * @param obj Other operand.
+         * @throws std::runtime_error on size mismatch.
+         */
+        void checkSize(const NumericVector<T> &obj) const
+        {
+            if (data.size() != obj.data.size())
+                throw(std::runtime_error("Size mismatch!"));
+        }
+
+        /**
+         * @brief Applies a binary kernel element-wise and returns the result.
+         */
+        template <typename Kernel>
+        NumericVector<T> apply(const NumericVector<T> &obj, Kernel kernel) const
+        {
+            checkSize(obj);
+            NumericVector<T> out(data.size());
+            kernel(data.data(), obj.data.data(), out.data.data(), data.size());
+            return out;
+        }
+
+        /**
+         * @brief Applies a scalar kernel element-wise and returns the result.
+         */
+        template <typename Kernel>
+        NumericVector<T> applyScalar(T s, Kernel kernel) const
+        {
+            NumericVector<T> out(data.size());
+            kernel(data.data(), s, out.data.data(), data.size());
+            return out;
+        }
+
+    public:
+        // =========================
+        // Constructors
+        // =========================
+
+        /**
+         * @brief Default constructor. Creates an empty vector.
+         */
+        NumericVector() = default;
+
+        /**
+         * @brief Construct with n copies of a value.
+         * @param n Number of elements.
+         * @param val Value of each element.
+         */
+        explicit NumericVector(std::size_t n, T val = T{}) : data(n, val) {}
+
+        /**
+         * @brief Construct from a list of values.
+         * @param values Initial values.
+         */
+        NumericVector(std::initializer_list<T> values) : data(values) {}
+
+        // =========================
+        // Element Access
+        // =========================
+
+        /**
+         * @brief Returns the number of elements.
+         */
+        std::size_t size() const
+        {
+            return data.size();
+        }
+
+        /**
+         * @brief Returns the element at index i.
+         */
+        T operator[](std::size_t i) const
+        {
+            return data[i];
+        }
+
+        /**
+         * @brief Sets the element at index i.
+         */
+        void set(std::size_t i, T val)
+        {
+            data[i] = val;
+        }
+
+        /**
+         * @brief Appends a value.
+         */
+        void push_back(T val)
+        {
+            data.push_back(val);
+        }
+
+        /**
+         * @brief Reserves storage for n elements.
+         */
+        void reserve(std::size_t n)
+        {
+            data.reserve(n);
+        }
+
+        /**
+         * @brief Resizes to n elements, value-initializing new ones.
+         */
+        void resize(std::size_t n)
+        {
+            data.resize(n);
+        }
+
+        /**
+         * @brief Returns a pointer to the contiguous storage.
+         */
+        const T *raw() const
+        {
+            return data.data();
+        }
+
+        /**
+         * @brief Returns a pointer to the contiguous storage.
+         */
+        T *raw()
+        {
+            return data.data();
+        }
+
+        // =========================
+        // Element-wise Operators
+        // =========================
+
+        NumericVector<T> operator+(const NumericVector<T> &obj) const { return apply(obj, simd::add<T>); }
+        NumericVector<T> operator-(const NumericVector<T> &obj) const { return apply(obj, simd::sub<T>); }
+        NumericVector<T> operator*(const NumericVector<T> &obj) const { return apply(obj, simd::mul<T>); }
+        NumericVector<T> operator/(const NumericVector<T> &obj) const { return apply(obj, simd::div<T>); }
+
+        NumericVector<T> operator+(T s) const { return applyScalar(s, simd::addScalar<T>); }
+        NumericVector<T> operator-(T s) const { return applyScalar(s, simd::subScalar<T>); }
+        NumericVector<T> operator*(T s) const { return applyScalar(s, simd::mulScalar<T>); }
+        NumericVector<T> operator/(T s) const { return applyScalar(s, simd::divScalar<T>); }
+
+        // =========================
+        // Compound Assignment Operators
+        // =========================
+
+        NumericVector<T> &operator+=(const NumericVector<T> &obj)
+        {
+            checkSize(obj);
+            simd::add(data.data(), obj.data.data(), data.data(), data.size());
+            return *this;
+        }
+
+        NumericVector<T> &operator-=(const NumericVector<T> &obj)
+        {
+            checkSize(obj);
+            simd::sub(data.data(), obj.data.data(), data.data(), data.size());
+            return *this;
+        }
+
+        NumericVector<T> &operator*=(const NumericVector<T> &obj)
+        {
+            checkSize(obj);
+            simd::mul(data.data(), obj.data.data(), data.data(), data.size());
+            return *this;
+        }
+
+        NumericVector<T> &operator/=(const NumericVector<T> &obj)
+        {
+            checkSize(obj);
+            simd::div(data.data(), obj.data.data(), data.data(), data.size());
+            return *this;
+        }
+
+        NumericVector<T> &operator+=(T s)
+        {
+            simd::addScalar(data.data(), s, data.data(), data.size());
+            return *this;
+        }
+
+        NumericVector<T> &operator-=(T s)
+        {
+            simd::subScalar(data.data(), s, data.data(), data.size());
+            return *this;
+        }
+
+        NumericVector<T> &operator*=(T s)
+        {
+            simd::mulScalar(data.data(), s, data.data(), data.size());
+            return *this;
+        }
+
+        NumericVector<T> &operator/=(T s)
+        {
+            simd::divScalar(data.data(), s, data.data(), data.size());
+            return *this;
+        }
+
+        /**
+         * @brief Returns every element as double, like Numeric::getValue().
+         * @return Vector of values as double.
+         */
+        NumericVector<double> getValue() const
+        {
+            NumericVector<double> out(data.size());
+            simd::toDouble(data.data(), out.raw(), data.size());
+            return out;
+        }
+
+        /**
+         * @brief Converts every element to U, e.g. float samples to Q15 and back.
+         * @return Vector of converted values.
+         */
+        template <typename U>
+        NumericVector<U> convert() const
+        {
+            NumericVector<U> out(data.size());
+            simd::convert(data.data(), out.raw(), data.size());
+            return out;
+        }
+    };
+
+    /**
+     * @brief NumericVector of complex numbers, stored as separate real and imaginary arrays.
+     *
+     * The split (structure-of-arrays) layout lets complex multiply, divide and
+     * magnitude run as plain vector arithmetic on each component.
+     *
+     * @tparam F Floating-point type of both parts.
+     */
+    template <typename F>
+    class NumericVector<Complex<F, F>>
+    {
+        static_assert(std::is_floating_point_v<F>, "NumericVector<Complex<F, F>> requires a floating-point F");
+
+    private:
+        std::vector<F> re; ///< Real parts
+        std::vector<F> im; ///< Imaginary parts
+
+        void checkSize(const NumericVector<Complex<F, F>> &obj) const
+        {
+            if (re.size() != obj.re.size())
+                throw(std::runtime_error("Size mismatch!"));
+        }
+
+    public:
+        // =========================
+        // Constructors
+        // =========================
+
+        /**
+         * @brief Default constructor. Creates an empty vector.
+         */
+        NumericVector() = default;
+
+        /**
+         * @brief Construct with n copies of a value.
+         * @param n Number of elements.
+         * @param val Value of each element.
+         */
+        explicit NumericVector(std::size_t n, Complex<F, F> val = Complex<F, F>(0, 0))
+            : re(n, val.getReal()), im(n, val.getImg()) {}
+
+        /**
+         * @brief Construct from a list of values.
+         * @param values Initial values.
+         */
+        NumericVector(std::initializer_list<Complex<F, F>> values)
+        {
+            reserve(values.size());
+            for (const auto &v : values)
+                push_back(v);
+        }
+
+        // =========================
+        // Element Access
+        // =========================
+
+        std::size_t size() const
+        {
+            return re.size();
+        }
+
+        Complex<F, F> operator[](std::size_t i) const
+        {
+            return Complex<F, F>(re[i], im[i]);
+        }
+
+        void set(std::size_t i, Complex<F, F> val)
+        {
+            re[i] = val.getReal();
+            im[i] = val.getImg();
+        }
+
+        void push_back(Complex<F, F> val)
+        {
+            re.push_back(val.getReal());
+            im.push_back(val.getImg());
+        }
+
+        void reserve(std::size_t n)
+        {
+            re.reserve(n);
+            im.reserve(n);
+        }
+
+        void resize(std::size_t n)
+        {
+            re.resize(n);
+            im.resize(n);
+        }
+
+        /**
+         * @brief Returns a pointer to the contiguous real parts.
+         */
+        const F *realData() const { return re.data(); }
+        F *realData() { return re.data(); }
+
+        /**
+         * @brief Returns a pointer to the contiguous imaginary parts.
+         */
+        const F *imagData() const { return im.data(); }
+        F *imagData() { return im.data(); }
+
+        // =========================
+        // Element-wise Operators
+        // =========================
+
+        NumericVector<Complex<F, F>> operator+(const NumericVector<Complex<F, F>> &obj) const
+        {
+            NumericVector<Complex<F, F>> out(*this);
+            return out += obj;
+        }
+
+        NumericVector<Complex<F, F>> operator-(const NumericVector<Complex<F, F>> &obj) const
+        {
+            NumericVector<Complex<F, F>> out(*this);
+            return out -= obj;
+        }
+
+        NumericVector<Complex<F, F>> operator*(const NumericVector<Complex<F, F>> &obj) const
+        {
+            checkSize(obj);
+            NumericVector<Complex<F, F>> out(size());
+            simd::complexMul(re.data(), im.data(), obj.re.data(), obj.im.data(), out.re.data(), out.im.data(), size());
+            return out;
+        }
+
+        NumericVector<Complex<F, F>> operator/(const NumericVector<Complex<F, F>> &obj) const
+        {
+            checkSize(obj);
+            NumericVector<Complex<F, F>> out(size());
+            simd::complexDiv(re.data(), im.data(), obj.re.data(), obj.im.data(), out.re.data(), out.im.data(), size());
+            return out;
+        }
+
+        NumericVector<Complex<F, F>> operator+(Complex<F, F> s) const
+        {
+            NumericVector<Complex<F, F>> out(*this);
+            return out += s;
+        }
+
+        NumericVector<Complex<F, F>> operator-(Complex<F, F> s) const
+        {
+            NumericVector<Complex<F, F>> out(*this);
+            return out -= s;
+        }
+
+        NumericVector<Complex<F, F>> operator*(Complex<F, F> s) const
+        {
+            NumericVector<Complex<F, F>> out(size());
+            simd::complexMulScalar(re.data(), im.data(), s.getReal(), s.getImg(), out.re.data(), out.im.data(), size());
+            return out;
+        }
+
+        NumericVector<Complex<F, F>> operator/(Complex<F, F> s) const
+        {
+            // Divide by s as a multiply by 1/s
+            return *this * reciprocal(s);
+        }
+
+        /**
+         * @brief Element-wise quotient with a selectable algorithm.
+         * @param obj Divisors, same size as this vector.
+         * @param mode Division::Smith avoids overflow when |obj[i]|^2 is out of range.
+         * @return Vector of quotients.
+         */
+        NumericVector<Complex<F, F>> divide(const NumericVector<Complex<F, F>> &obj, Division mode) const
+        {
+            if (mode == Division::Fast)
+                return *this / obj;
+            checkSize(obj);
+            NumericVector<Complex<F, F>> out(size());
+            simd::complexDivSmith(re.data(), im.data(), obj.re.data(), obj.im.data(), out.re.data(), out.im.data(), size());
+            return out;
+        }
+
+        // =========================
+        // Compound Assignment Operators
+        // =========================
+
+        NumericVector<Complex<F, F>> &operator+=(const NumericVector<Complex<F, F>> &obj)
+        {
+            checkSize(obj);
+            simd::add(re.data(), obj.re.data(), re.data(), size());
+            simd::add(im.data(), obj.im.data(), im.data(), size());
+            return *this;
+        }
+
+        NumericVector<Complex<F, F>> &operator-=(const NumericVector<Complex<F, F>> &obj)
+        {
+            checkSize(obj);
+            simd::sub(re.data(), obj.re.data(), re.data(), size());
+            simd::sub(im.data(), obj.im.data(), im.data(), size());
+            return *this;
+        }
+
+        NumericVector<Complex<F, F>> &operator*=(const NumericVector<Complex<F, F>> &obj)
+        {
+            checkSize(obj);
+            simd::complexMul(re.data(), im.data(), obj.re.data(), obj.im.data(), re.data(), im.data(), size());
+            return *this;
+        }
+
+        NumericVector<Complex<F, F>> &operator/=(const NumericVector<Complex<F, F>> &obj)
+        {
+            checkSize(obj);
+            simd::complexDiv(re.data(), im.data(), obj.re.data(), obj.im.data(), re.data(), im.data(), size());
+            return *this;
+        }
+
+        NumericVector<Complex<F, F>> &operator+=(Complex<F, F> s)
+        {
+            simd::addScalar(re.data(), s.getReal(), re.data(), size());
+            simd::addScalar(im.data(), s.getImg(), im.data(), size());
+            return *this;
+        }
+
+        NumericVector<Complex<F, F>> &operator-=(Complex<F, F> s)
+        {
+            simd::subScalar(re.data(), s.getReal(), re.data(), size());
+            simd::subScalar(im.data(), s.getImg(), im.data(), size());
+            return *this;
+        }
+
+        NumericVector<Complex<F, F>> &operator*=(Complex<F, F> s)
+        {
+            simd::complexMulScalar(re.data(), im.data(), s.getReal(), s.getImg(), re.data(), im.data(), size());
+            return *this;
+        }
+
+        NumericVector<Complex<F, F>> &operator/=(Complex<F, F> s)
+        {
+            return *this *= reciprocal(s);
+        }
+
+        /**
+         * @brief Returns the magnitude of every element, like Complex::getValue().
+         * @return Vector of magnitudes.
+         */
+        NumericVector<F> getValue() const
+        {
+            NumericVector<F> out(size());
+            simd::magnitude(re.data(), im.data(), out.raw(), size());
+            return out;
+        }
+    };
+}
@@ -0,0 +1,271 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "NumericVector.hpp"
+#include "Reduce.hpp"
+#include "ThreadPool.hpp"
+#include "Type.hpp"
+
+/**
+ * @file Parallel.hpp
+ * @brief Element-wise transforms and reductions over large arrays, run
+ *        sequentially or on a ThreadPool according to an execution policy.
+ *
+ * @code
+ * Parallel par;                                   // global pool, deterministic sums
+ * parallelTransform(par, a, b, n, out, [](auto x, auto y) { return x * y; });
+ * double s = parallelSum(par, values.raw(), values.size());
+ * @endcode
+ *
+ * Work is split into blocks of about CACHE_BLOCK_BYTES of input, so each block
+ * stays in a core's L2 cache and the block layout does not depend on the
+ * number of threads. With Reduction::Deterministic every block is reduced on
+ * its own and the partial results are combined pairwise in index order, so a
+ * floating-point sum is bit-identical on 1 or 64 threads (and with
+ * Sequential). Reduction::Fast instead runs one task per pool thread, each
+ * folding a contiguous run of blocks into a local accumulator, and combines
+ * only those size() results: fewer tasks to schedule and no per-block
+ * partials array. The split depends on the pool size, so the result is
+ * reproducible for a given pool but its last bits change with the thread
+ * count, and uneven blocks are not rebalanced by stealing.
+ */
+
+namespace myStd
+{
+    /// Bytes of input per block when the policy does not set a grain.
+    constexpr std::size_t CACHE_BLOCK_BYTES = 64 * 1024;
+
+    /**
+     * @brief How partial results of a parallel reduction are combined.
+     */
+    enum class Reduction
+    {
+        Deterministic, ///< Fixed blocks combined in index order; same result for any thread count
+        Fast           ///< One accumulator per pool thread; result depends on the thread count
+    };
+
+    /**
+     * @brief Policy running everything on the calling thread, block by block.
+     */
+    struct Sequential
+    {
+        std::size_t grain = 0; ///< Elements per block; 0 for CACHE_BLOCK_BYTES worth
+    };
+
+    /**
+     * @brief Policy running blocks on a work-stealing ThreadPool.
+     */
+    struct Parallel
+    {
+        ThreadPool *pool = nullptr;                      ///< Pool to run on; nullptr for ThreadPool::global()
+        std::size_t grain = 0;                           ///< Elements per block; 0 for CACHE_BLOCK_BYTES worth
+        Reduction reduction = Reduction::Deterministic; ///< Combination order of reductions
+
+        ThreadPool &executor() const { return pool ? *pool : ThreadPool::global(); }
+    };
+
+    namespace detail
+    {
+        template <typename T, typename Policy>
+        std::size_t grainFor(const Policy &policy)
+        {
+            return policy.grain ? policy.grain : std::max<std::size_t>(1, CACHE_BLOCK_BYTES / sizeof(T));
+        }
+
+        template <typename F>
+        void forBlocks(const Sequential &, std::size_t n, std::size_t grain, F &&f)
+        {
+            for (std::size_t b = 0; b < n; b += grain)
+                f(b, std::min(n, b + grain));
+        }
+
+        template <typename F>
+        void forBlocks(const Parallel &policy, std::size_t n, std::size_t grain, F &&f)
+        {
+            policy.executor().parallelFor(n, grain, std::forward<F>(f));
+        }
+
+        /// Combines parts[first, last) pairwise, always in the same tree shape.
+        template <typename Acc, typename Combine>
+        Acc combineTree(std::vector<Acc> &parts, std::size_t first, std::size_t last, Combine &combine)
+        {
+            if (last - first == 1)
+                return std::move(parts[first]);
+            std::size_t mid = first + (last - first) / 2;
+            Acc left = combineTree(parts, first, mid, combine);
+            return combine(std::move(left), combineTree(parts, mid, last, combine));
+        }
+
+        /// Per-task accumulator on its own cache line.
+        template <typename Acc>
+        struct alignas(64) Partial
+        {
+            Acc value;
+        };
+    }
+
+    // =========================
+    // Transform
+    // =========================
+
+    /**
+     * @brief out[i] = f(in[i]) for i in [0, n).
+     * @param policy Sequential or Parallel.
+     * @param in Input array.
+     * @param n Number of elements.
+     * @param out Output array; may be in.
+     * @param f Callable taking const T& and returning a value assignable to Out.
+     */
+    template <typename Policy, typename T, typename Out, typename F>
+    void parallelTransform(const Policy &policy, const T *in, std::size_t n, Out *out, F f)
+    {
+        detail::forBlocks(policy, n, detail::grainFor<T>(policy), [&](std::size_t begin, std::size_t end)
+                          {
+            for (std::size_t i = begin; i < end; ++i)
+                out[i] = f(in[i]); });
+    }
+
+    /**
+     * @brief out[i] = f(a[i], b[i]) for i in [0, n).
+     * @param policy Sequential or Parallel.
+     * @param a First input array.
+     * @param b Second input array.
+     * @param n Number of elements.
+     * @param out Output array; may be a or b.
+     * @param f Callable taking (const A&, const B&) and returning a value assignable to Out.
+     */
+    template <typename Policy, typename A, typename B, typename Out, typename F>
+    void parallelTransform(const Policy &policy, const A *a, const B *b, std::size_t n, Out *out, F f)
+    {
+        detail::forBlocks(policy, n, detail::grainFor<A>(policy), [&](std::size_t begin, std::size_t end)
+                          {
+            for (std::size_t i = begin; i < end; ++i)
+                out[i] = f(a[i], b[i]); });
+    }
+
+    /**
+     * @brief Element-wise operation on two NumericVectors of the same size.
+     * @throws std::runtime_error on size mismatch.
+     */
+    template <typename Policy, typename T, typename F>
+    NumericVector<T> parallelTransform(const Policy &policy, const NumericVector<T> &a, const NumericVector<T> &b, F f)
+    {
+        if (a.size() != b.size())
+            throw(std::runtime_error("Size mismatch!"));
+        NumericVector<T> out(a.size());
+        parallelTransform(policy, a.raw(), b.raw(), a.size(), out.raw(), f);
+        return out;
+    }
+
+    // =========================
+    // Reduce
+    // =========================
+
+    /**
+     * @brief Reduces data[0, n) block by block.
+     *
+     * Each block is reduced with reduceBlock(const T *first, std::size_t count),
+     * which can use the vectorized loops of Reduce.hpp, and the block results
+     * are merged with combine(Acc, Acc). combine must be associative; identity
+     * is returned for n == 0.
+     *
+     * @param policy Sequential or Parallel; Parallel::reduction picks the combination order.
+     * @return The reduction of all elements.
+     */
+    template <typename Policy, typename T, typename Acc, typename ReduceBlock, typename Combine>
+    Acc parallelReduce(const Policy &policy, const T *data, std::size_t n, Acc identity, ReduceBlock reduceBlock, Combine combine)
+    {
+        if (n == 0)
+            return identity;
+        std::size_t grain = detail::grainFor<T>(policy);
+
+        if constexpr (std::is_same_v<Policy, Parallel>)
+        {
+            if (policy.reduction == Reduction::Fast)
+            {
+                ThreadPool &pool = policy.executor();
+                // One task per thread folds a contiguous run of blocks; each task owns its slot,
+                // since a waiting thread may also run another caller's tasks
+                std::size_t blocks = (n + grain - 1) / grain;
+                std::size_t perTask = (blocks + pool.size() - 1) / pool.size();
+                std::size_t tasks = (blocks + perTask - 1) / perTask;
+                std::vector<detail::Partial<Acc>> partials(tasks, detail::Partial<Acc>{identity});
+                pool.parallelFor(tasks, 1, [&](std::size_t task, std::size_t)
+                                 {
+                    std::size_t begin = task * perTask * grain, end = std::min(n, begin + perTask * grain);
+                    Acc acc = reduceBlock(data + begin, std::min(end - begin, grain));
+                    for (std::size_t b = begin + grain; b < end; b += grain)
+                        acc = combine(std::move(acc), reduceBlock(data + b, std::min(end - b, grain)));
+                    partials[task].value = std::move(acc); });
+                Acc total = std::move(partials[0].value);
+                for (std::size_t i = 1; i < tasks; ++i)
+                    total = combine(std::move(total), std::move(partials[i].value));
+                return total;
+            }
+        }
+
+        std::vector<Acc> parts((n + grain - 1) / grain, identity);
+        detail::forBlocks(policy, n, grain, [&](std::size_t begin, std::size_t end)
+                          { parts[begin / grain] = reduceBlock(data + begin, end - begin); });
+        return detail::combineTree(parts, 0, parts.size(), combine);
+    }
+
+    /**
+     * @brief Sums an int, double, Complex or Type<T> array.
+     *
+     * Floating-point blocks are summed pairwise; with a deterministic policy the
+     * result depends only on the data and the grain.
+     *
+     * @return Sum of the elements, of the same type as sum(data, n).
+     */
+    template <typename Policy, typename T>
+    auto parallelSum(const Policy &policy, const T *data, std::size_t n)
+    {
+        using Acc = decltype(sum(data, n));
+        return parallelReduce(
+            policy, data, n, Acc{}, [](const T *first, std::size_t count) -> Acc
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                    return sum(first, count, Summation::Pairwise);
+                else
+                    return sum(first, count); },
+            [](Acc x, const Acc &y) -> Acc
+            { return x + y; });
+    }
+
+    /**
+     * @brief Sums a NumericVector.
+     */
+    template <typename Policy, typename T>
+    T parallelSum(const Policy &policy, const NumericVector<T> &v)
+    {
+        return parallelSum(policy, v.raw(), v.size());
+    }
+
+    template <typename Policy, typename F>
+    Complex<F, F> parallelSum(const Policy &policy, const NumericVector<Complex<F, F>> &v)
+    {
+        return Complex<F, F>(parallelSum(policy, v.realData(), v.size()), parallelSum(policy, v.imagData(), v.size()));
+    }
+
+    /**
+     * @brief Dot product of two arithmetic arrays.
+     */
+    template <typename Policy, typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    T parallelDot(const Policy &policy, const T *a, const T *b, std::size_t n)
+    {
+        // Reduce over indices so each block sees matching slices of a and b
+        return parallelReduce(
+            policy, a, n, T{}, [a, b](const T *first, std::size_t count)
+            { return dot(first, b + (first - a), count); },
+            [](T x, T y)
+            { return x + y; });
+    }
+}
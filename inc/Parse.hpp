@@ -0,0 +1,339 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "Fixed.hpp"
+
+/**
+ * @file Parse.hpp
+ * @brief Locale-free, allocation-free parsing and formatting of int, double,
+ *        float, fixed-point and Complex values on top of std::from_chars /
+ *        std::to_chars.
+ *
+ * Complex values are read in the form written by operator<<, "(3 + 4i)", and
+ * in the compact forms "3+4i", "3-4.5i" and "3" (imaginary part 0). Spaces
+ * inside the parentheses are optional. Floating-point values are formatted in
+ * the shortest form that reads back to the same value.
+ *
+ * The bulk functions read values separated by whitespace, ',' or ';' and
+ * throw std::runtime_error with the offset of the first malformed value.
+ * BigInt.hpp adds parse, format and toString overloads for BigInt, so the
+ * bulk functions take BigInt too when both headers are included.
+ */
+
+namespace myStd
+{
+    class BigInt;
+
+    namespace detail
+    {
+        inline const char *skipSpaces(const char *p, const char *last) noexcept
+        {
+            while (p != last && (*p == ' ' || *p == '\t'))
+                ++p;
+            return p;
+        }
+
+        inline bool isSeparator(char c) noexcept
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',' || c == ';';
+        }
+
+        /// from_chars for one arithmetic value, also accepting a leading '+'.
+        template <typename T>
+        std::from_chars_result parseScalar(const char *first, const char *last, T &out) noexcept
+        {
+            const char *p = first;
+            if (p != last && *p == '+')
+                ++p;
+            if (p != last && *p == '-' && p != first)
+                return {first, std::errc::invalid_argument};
+            auto r = std::from_chars(p, last, out);
+            if (r.ec != std::errc())
+                return {first, r.ec};
+            return r;
+        }
+    }
+
+    /**
+     * @brief Parses one int or double at the start of [first, last).
+     * @param first Start of the text.
+     * @param last End of the text.
+     * @param out Parsed value; unchanged on failure.
+     * @return Pointer past the value and std::errc() on success, first and an error otherwise.
+     */
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic_v<T>, std::from_chars_result>
+    parse(const char *first, const char *last, T &out) noexcept
+    {
+        return detail::parseScalar(first, last, out);
+    }
+
+    /**
+     * @brief Parses one fixed-point value written as a decimal, rounding and saturating like Fixed(double).
+     * @return Pointer past the value and std::errc() on success, first and an error otherwise.
+     */
+    template <typename Raw, int FRAC>
+    std::from_chars_result parse(const char *first, const char *last, Fixed<Raw, FRAC> &out) noexcept
+    {
+        double v;
+        auto r = detail::parseScalar(first, last, v);
+        if (r.ec == std::errc())
+            out = Fixed<Raw, FRAC>(v);
+        return r;
+    }
+
+    /**
+     * @brief Parses one complex value, "(a + bi)", "a+bi", "a-bi" or "a", at the start of [first, last).
+     * @param first Start of the text.
+     * @param last End of the text.
+     * @param out Parsed value; unchanged on failure.
+     * @return Pointer past the value and std::errc() on success, first and an error otherwise.
+     */
+    template <typename T, typename U>
+    std::from_chars_result parse(const char *first, const char *last, Complex<T, U> &out) noexcept
+    {
+        const std::from_chars_result fail{first, std::errc::invalid_argument};
+        const char *p = first;
+        bool paren = p != last && *p == '(';
+        if (paren)
+            p = detail::skipSpaces(p + 1, last);
+
+        T re{};
+        auto r = detail::parseScalar(p, last, re);
+        if (r.ec != std::errc())
+            return {first, r.ec};
+        p = r.ptr;
+
+        // Optional "+ bi" / "- bi"; without a trailing 'i' it belongs to the next value
+        U im{};
+        const char *q = detail::skipSpaces(p, last);
+        if (q != last && (*q == '+' || *q == '-'))
+        {
+            bool negative = *q == '-';
+            const char *s = detail::skipSpaces(q + 1, last);
+            std::from_chars_result ri;
+            if constexpr (std::is_integral_v<U>)
+            {
+                // Read the magnitude unsigned, so the most negative value round-trips
+                using M = std::make_unsigned_t<U>;
+                M magnitude{};
+                ri = std::from_chars(s, last, magnitude);
+                if (ri.ec == std::errc() && magnitude > static_cast<M>(static_cast<M>(std::numeric_limits<U>::max()) + negative))
+                    ri.ec = std::errc::result_out_of_range;
+                im = static_cast<U>(negative ? static_cast<M>(0u - magnitude) : magnitude);
+            }
+            else
+            {
+                ri = std::from_chars(s, last, im);
+                if (negative)
+                    im = -im;
+            }
+            if (ri.ec == std::errc() && ri.ptr != last && *ri.ptr == 'i')
+                p = ri.ptr + 1;
+            else
+                im = U{};
+        }
+
+        if (paren)
+        {
+            p = detail::skipSpaces(p, last);
+            if (p == last || *p != ')')
+                return fail;
+            ++p;
+        }
+        out = Complex<T, U>(re, im);
+        return {p, std::errc()};
+    }
+
+    /**
+     * @brief Parses a whole string as one value.
+     * @param text Text holding exactly one value, surrounding whitespace allowed.
+     * @return Parsed value.
+     * @throws std::runtime_error if text is not a single valid value.
+     */
+    template <typename T>
+    T parseValue(std::string_view text)
+    {
+        const char *first = text.data(), *last = first + text.size();
+        while (first != last && detail::isSeparator(*first))
+            ++first;
+        T out{};
+        auto r = parse(first, last, out);
+        const char *p = r.ptr;
+        while (p != last && detail::isSeparator(*p))
+            ++p;
+        if (r.ec != std::errc() || p != last)
+            throw(std::runtime_error("Malformed number: " + std::string(text)));
+        return out;
+    }
+
+    // =========================
+    // Formatting
+    // =========================
+
+    /**
+     * @brief Writes an int or double to [first, last).
+     * @return Pointer past the text and std::errc(), or last and std::errc::value_too_large.
+     */
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic_v<T>, std::to_chars_result>
+    format(char *first, char *last, T value) noexcept
+    {
+        return std::to_chars(first, last, value);
+    }
+
+    /**
+     * @brief Writes a fixed-point value as its shortest round-tripping decimal.
+     */
+    template <typename Raw, int FRAC>
+    std::to_chars_result format(char *first, char *last, Fixed<Raw, FRAC> value) noexcept
+    {
+        return std::to_chars(first, last, static_cast<double>(value));
+    }
+
+    /**
+     * @brief Writes a complex value as "(a + bi)" or "(a - bi)", like operator<<.
+     * @return Pointer past the text and std::errc(), or last and std::errc::value_too_large.
+     */
+    template <typename T, typename U>
+    std::to_chars_result format(char *first, char *last, const Complex<T, U> &value) noexcept
+    {
+        const std::to_chars_result full{last, std::errc::value_too_large};
+        char *p = first;
+        if (p == last)
+            return full;
+        *p++ = '(';
+        auto r = std::to_chars(p, last, value.getReal());
+        if (r.ec != std::errc() || last - r.ptr < 3)
+            return full;
+        p = r.ptr;
+        U im = value.getImg();
+        bool negative = im < 0 || (std::is_floating_point_v<U> && std::signbit(static_cast<double>(im)));
+        *p++ = ' ';
+        *p++ = negative ? '-' : '+';
+        *p++ = ' ';
+        if constexpr (std::is_integral_v<U>)
+        {
+            // Negate in unsigned arithmetic: -im overflows for the most negative value
+            using M = std::make_unsigned_t<U>;
+            M magnitude = static_cast<M>(im);
+            r = std::to_chars(p, last, negative ? static_cast<M>(0u - magnitude) : magnitude);
+        }
+        else
+            r = std::to_chars(p, last, negative ? -im : im);
+        if (r.ec != std::errc() || last - r.ptr < 2)
+            return full;
+        p = r.ptr;
+        *p++ = 'i';
+        *p++ = ')';
+        return {p, std::errc()};
+    }
+
+    /// Buffer size that fits any value formatted by format(), except a BigInt.
+    constexpr std::size_t MAX_FORMAT_CHARS = 80;
+
+    /**
+     * @brief Formats a value into a new string.
+     */
+    template <typename T>
+    std::string toString(const T &value)
+    {
+        char buf[MAX_FORMAT_CHARS];
+        auto r = format(buf, buf + sizeof(buf), value);
+        return std::string(buf, r.ptr);
+    }
+
+    // =========================
+    // Bulk Parsing and Formatting
+    // =========================
+
+    namespace detail
+    {
+        /**
+         * @brief Parses the value after any separators at p and advances p past it.
+         * @param first Start of the text, for error offsets.
+         * @return false if only separators were left.
+         * @throws std::runtime_error if the value is malformed.
+         */
+        template <typename T>
+        bool parseNext(const char *&p, const char *first, const char *last, T &out)
+        {
+            while (p != last && isSeparator(*p))
+                ++p;
+            if (p == last)
+                return false;
+            auto r = parse(p, last, out);
+            if (r.ec != std::errc() || (r.ptr != last && !isSeparator(*r.ptr)))
+                throw(std::runtime_error("Malformed number at offset " + std::to_string(p - first)));
+            p = r.ptr;
+            return true;
+        }
+    }
+
+    /**
+     * @brief Parses separated values from text directly into an array.
+     * @param text Values separated by whitespace, ',' or ';'.
+     * @param out Destination array.
+     * @param capacity Number of elements out can hold; parsing stops when it is full.
+     * @return Number of values written.
+     * @throws std::runtime_error at the first malformed value.
+     */
+    template <typename T>
+    std::size_t parseArray(std::string_view text, T *out, std::size_t capacity)
+    {
+        const char *first = text.data(), *p = first, *last = first + text.size();
+        std::size_t n = 0;
+        while (n < capacity && detail::parseNext(p, first, last, out[n]))
+            ++n;
+        return n;
+    }
+
+    /**
+     * @brief Parses all separated values in text and appends them to out.
+     * @throws std::runtime_error at the first malformed value.
+     */
+    template <typename T>
+    void parseArray(std::string_view text, std::vector<T> &out)
+    {
+        // Grow with the values found: sizing from the character count over-allocates
+        // several times over for wide types such as Complex<double, double>
+        const char *first = text.data(), *p = first, *last = first + text.size();
+        T value{};
+        while (detail::parseNext(p, first, last, value))
+            out.push_back(value);
+    }
+
+    /**
+     * @brief Appends n values to out, each followed by separator.
+     */
+    template <typename T>
+    void formatArray(const T *data, std::size_t n, std::string &out, char separator = '\n')
+    {
+        char buf[MAX_FORMAT_CHARS + 1];
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if constexpr (std::is_same_v<T, BigInt>)
+            {
+                out += data[i].toString();
+                out += separator;
+            }
+            else
+            {
+                char *p = format(buf, buf + MAX_FORMAT_CHARS, data[i]).ptr;
+                *p++ = separator;
+                out.append(buf, p);
+            }
+        }
+    }
+}
@@ -0,0 +1,319 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Promotion.hpp"
+#include "Parse.hpp"
+#include "Serialize.hpp"
+
+/**
+ * @file Pipeline.hpp
+ * @brief Chunked streaming over int, double and Complex values with bounded memory.
+ *
+ * A pipeline is a source followed by any number of stages and one terminal:
+ *
+ * @code
+ * std::ifstream in("feed.txt");
+ * double total = fromStream<Complex<double, double>>(in)
+ *                    .filterByMagnitude(1.0, 100.0)
+ *                    .map([](const Complex<double, double> &c) { return ops::add(c, 0.5); })
+ *                    .map([](const Complex<double, double> &c) { return c.getValue(); })
+ *                    .reduce(0.0, [](double a, double b) { return a + b; });
+ * @endcode
+ *
+ * Values move through the chain one chunk at a time; every stage owns at most
+ * one chunk-sized buffer, so memory does not grow with the length of the input.
+ * Each stage is a template over the previous one and is inlined into a single
+ * loop per chunk; nothing is allocated per value.
+ *
+ * The building block is a pull function, std::size_t pull(T *out, std::size_t
+ * capacity), that writes up to capacity values and returns how many it wrote,
+ * 0 only once the input is exhausted.
+ */
+
+namespace myStd
+{
+    /// Values per chunk when none is given.
+    constexpr std::size_t DEFAULT_CHUNK = 4096;
+
+    /**
+     * @brief A source and its stages, ready for more stages or a terminal.
+     *
+     * Pipelines are move-only in practice (stages own buffers) and each stage or
+     * terminal consumes the pipeline it is called on.
+     *
+     * @tparam T Type of the values produced.
+     * @tparam Pull Pull function of the last stage.
+     */
+    template <typename T, typename Pull>
+    class Pipeline
+    {
+    private:
+        Pull pull;
+        std::size_t chunk;
+
+    public:
+        using value_type = T;
+
+        Pipeline(Pull pull, std::size_t chunk) : pull(std::move(pull)), chunk(chunk)
+        {
+            if (chunk == 0)
+                throw(std::runtime_error("Pipeline chunk size must be positive"));
+        }
+
+        /// Chunk size of this pipeline.
+        std::size_t chunkSize() const { return chunk; }
+
+        /**
+         * @brief Fills out with the next values.
+         * @return Number of values written, 0 once the input is exhausted.
+         */
+        std::size_t next(T *out, std::size_t capacity) { return pull(out, capacity); }
+
+        // =========================
+        // Stages
+        // =========================
+
+        /**
+         * @brief Transforms every value, e.g. with ops::add or Complex arithmetic.
+         * @param f Callable taking const T& and returning the new value.
+         * @return Pipeline of f's results.
+         */
+        template <typename F>
+        auto map(F f) &&
+        {
+            using R = std::decay_t<std::invoke_result_t<F &, const T &>>;
+            auto stage = [up = std::move(pull), f = std::move(f), buf = std::vector<T>(chunk)](R *out, std::size_t capacity) mutable
+            {
+                std::size_t n = up(buf.data(), std::min(capacity, buf.size()));
+                for (std::size_t i = 0; i < n; ++i)
+                    out[i] = f(buf[i]);
+                return n;
+            };
+            return Pipeline<R, decltype(stage)>(std::move(stage), chunk);
+        }
+
+        /**
+         * @brief Keeps the values for which pred returns true.
+         * @param pred Callable taking const T& and returning bool.
+         * @return Pipeline of the kept values.
+         */
+        template <typename P>
+        auto filter(P pred) &&
+        {
+            auto stage = [up = std::move(pull), pred = std::move(pred)](T *out, std::size_t capacity) mutable
+            {
+                // Compact each pulled chunk in place; only an exhausted input ends the stream
+                for (;;)
+                {
+                    std::size_t n = up(out, capacity);
+                    if (n == 0)
+                        return std::size_t(0);
+                    std::size_t kept = 0;
+                    for (std::size_t i = 0; i < n; ++i)
+                        if (pred(out[i]))
+                            out[kept++] = out[i];
+                    if (kept)
+                        return kept;
+                }
+            };
+            return Pipeline<T, decltype(stage)>(std::move(stage), chunk);
+        }
+
+        /**
+         * @brief Keeps the values whose getValue() magnitude lies in [lo, hi].
+         *        Arithmetic values are compared by value, as Type<T>::getValue() does.
+         */
+        auto filterByMagnitude(double lo, double hi) &&
+        {
+            return std::move(*this).filter([lo, hi](const T &v)
+                                            {
+                double m = ops::valueOf(v);
+                return m >= lo && m <= hi; });
+        }
+
+        // =========================
+        // Terminals
+        // =========================
+
+        /**
+         * @brief Calls sink(const T *data, std::size_t n) once per chunk.
+         */
+        template <typename Sink>
+        void forEachChunk(Sink sink) &&
+        {
+            std::vector<T> buf(chunk);
+            while (std::size_t n = pull(buf.data(), buf.size()))
+                sink(static_cast<const T *>(buf.data()), n);
+        }
+
+        /**
+         * @brief Calls f(const T &) for every value.
+         */
+        template <typename F>
+        void forEach(F f) &&
+        {
+            std::move(*this).forEachChunk([&f](const T *data, std::size_t n)
+                                          {
+                for (std::size_t i = 0; i < n; ++i)
+                    f(data[i]); });
+        }
+
+        /**
+         * @brief Folds every value into an accumulator.
+         * @param init Initial accumulator.
+         * @param op Callable (Acc, const T&) -> Acc.
+         * @return Final accumulator.
+         */
+        template <typename Acc, typename Op>
+        Acc reduce(Acc init, Op op) &&
+        {
+            std::move(*this).forEach([&](const T &v)
+                                     { init = op(std::move(init), v); });
+            return init;
+        }
+
+        /**
+         * @brief Number of values that reach the end of the pipeline.
+         */
+        std::size_t count() &&
+        {
+            std::size_t total = 0;
+            std::move(*this).forEachChunk([&total](const T *, std::size_t n)
+                                          { total += n; });
+            return total;
+        }
+
+        /**
+         * @brief Writes every value as text, each followed by separator.
+         */
+        void writeText(std::ostream &os, char separator = '\n') &&
+        {
+            std::string text;
+            std::move(*this).forEachChunk([&](const T *data, std::size_t n)
+                                          {
+                text.clear();
+                formatArray(data, n, text, separator);
+                os.write(text.data(), static_cast<std::streamsize>(text.size())); });
+            if (!os)
+                throw(std::runtime_error("Failed to write pipeline output"));
+        }
+
+        /**
+         * @brief Appends every value to a vector. Materializes the stream; meant for bounded inputs.
+         */
+        void collect(std::vector<T> &out) &&
+        {
+            std::move(*this).forEachChunk([&out](const T *data, std::size_t n)
+                                          { out.insert(out.end(), data, data + n); });
+        }
+    };
+
+    /**
+     * @brief Builds a pipeline from a pull function.
+     * @tparam T Type of the values produced.
+     */
+    template <typename T, typename Pull>
+    Pipeline<T, Pull> makePipeline(Pull pull, std::size_t chunk = DEFAULT_CHUNK)
+    {
+        return Pipeline<T, Pull>(std::move(pull), chunk);
+    }
+
+    // =========================
+    // Sources
+    // =========================
+
+    /**
+     * @brief Streams an existing array, e.g. a MappedArray, without copying it up front.
+     */
+    template <typename T>
+    auto fromArray(const T *data, std::size_t n, std::size_t chunk = DEFAULT_CHUNK)
+    {
+        return makePipeline<T>([data, n, pos = std::size_t(0)](T *out, std::size_t capacity) mutable
+                               {
+            std::size_t k = std::min(capacity, n - pos);
+            std::copy(data + pos, data + pos + k, out);
+            pos += k;
+            return k; },
+                               chunk);
+    }
+
+    /**
+     * @brief Streams text values from a stream, parsed with from_chars.
+     *
+     * Values are separated by whitespace, ',' or ';' and must not span lines.
+     * Text is read in blocks and cut at the last newline, so memory is bounded
+     * by the block size plus the longest line.
+     *
+     * @throws std::runtime_error (while pulling) at a malformed value.
+     */
+    template <typename T>
+    auto fromStream(std::istream &is, std::size_t chunk = DEFAULT_CHUNK)
+    {
+        constexpr std::size_t BLOCK = 1 << 16;
+        return makePipeline<T>([&is, text = std::string(), pos = std::size_t(0), safe = std::size_t(0), done = false](T *out, std::size_t capacity) mutable
+                               {
+            std::size_t k = 0;
+            while (k < capacity)
+            {
+                while (pos < safe && detail::isSeparator(text[pos]))
+                    ++pos;
+                if (pos >= safe)
+                {
+                    if (done)
+                        break;
+                    // Drop the consumed text, read a block, parse up to the last complete line
+                    text.erase(0, pos);
+                    pos = 0;
+                    std::size_t used = text.size();
+                    text.resize(used + BLOCK);
+                    is.read(&text[used], BLOCK);
+                    text.resize(used + static_cast<std::size_t>(is.gcount()));
+                    done = !is;
+                    std::size_t nl = text.rfind('\n');
+                    safe = done ? text.size() : (nl == std::string::npos ? 0 : nl + 1);
+                    continue;
+                }
+                const char *first = text.data() + pos, *last = text.data() + safe;
+                auto r = parse(first, last, out[k]);
+                if (r.ec != std::errc() || (r.ptr != last && !detail::isSeparator(*r.ptr)))
+                    throw(std::runtime_error("Malformed number in stream at: " + text.substr(pos, 32)));
+                pos = static_cast<std::size_t>(r.ptr - text.data());
+                ++k;
+            }
+            return k; },
+                               chunk);
+    }
+
+    /**
+     * @brief Streams a binary array file written by writeArray<T>, one chunk per read.
+     * @throws std::runtime_error if the file can't be opened or does not hold T.
+     */
+    template <typename T>
+    auto fromFile(const std::string &path, std::size_t chunk = DEFAULT_CHUNK)
+    {
+        detail::checkSerializable<T>();
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            throw(std::runtime_error("Can't open " + path));
+        FileHeader h = detail::readHeader(file);
+        detail::checkHeader(h, typeTag<T>, sizeof(T));
+        detail::skipToPayload(file, h);
+        return makePipeline<T>([file = std::move(file), left = h.count](T *out, std::size_t capacity) mutable
+                               {
+            std::size_t k = static_cast<std::size_t>(std::min<std::uint64_t>(capacity, left));
+            if (k && !file.read(reinterpret_cast<char *>(out), static_cast<std::streamsize>(k * sizeof(T))))
+                throw(std::runtime_error("Truncated numeric array file"));
+            left -= k;
+            return k; },
+                               chunk);
+    }
+}
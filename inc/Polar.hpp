@@ -0,0 +1,471 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+
+#include "Complex.hpp"
+#include "Simd.hpp"
+
+/**
+ * @file Polar.hpp
+ * @brief Complex numbers stored as magnitude and angle, with batch
+ *        conversion to and from the rectangular Complex<F, F>.
+ *
+ * @code
+ * PolarComplex<double> z(Complex<double, double>(3.0, 4.0));   // magnitude 5, angle atan2(4, 3)
+ * auto w = pow(z, 10.0) / z;                                   // two multiplies and an add
+ * double m = w.getValue();                                     // a field read, no sqrt
+ * toPolar(rect, polar, n);                                     // n conversions, vectorized
+ * @endcode
+ *
+ * Multiplication, division, powers and magnitude comparisons are exact field
+ * operations in polar form; addition and subtraction go through rectangular
+ * form and cost a conversion each way. Angles are kept in (-pi, pi], and a
+ * zero magnitude has angle 0, so equal values compare equal.
+ *
+ * The batch conversions use branch-free polynomial approximations of atan2,
+ * sin and cos (Cephes coefficients, accurate to about 2 ulp for double and
+ * float) instead of the libm calls, so the loops vectorize: four doubles or
+ * eight floats per AVX instruction. They work on blocks of POLAR_BLOCK values
+ * split into real and imaginary arrays.
+ */
+
+namespace myStd
+{
+    /// Values per block in the interleaved batch conversions.
+    constexpr std::size_t POLAR_BLOCK = 64;
+
+    namespace detail
+    {
+        template <typename F>
+        constexpr F PI_V = F(3.14159265358979323846264338327950288);
+
+        /// Maps an angle in (-3 pi, 3 pi] into (-pi, pi]. Branch-free: sums of random
+        /// angles wrap about a quarter of the time, which a branch would mispredict.
+        template <typename F>
+        F wrapAngle(F a)
+        {
+            a -= 2 * PI_V<F> * static_cast<F>(a > PI_V<F>);
+            a += 2 * PI_V<F> * static_cast<F>(a <= -PI_V<F>);
+            return a;
+        }
+
+        /// Polynomial coefficients of the batch kernels for float and double.
+        template <typename F>
+        struct PolarCoeffs;
+
+        template <>
+        struct PolarCoeffs<double>
+        {
+            /// atan(u) = u + u z P(z) / Q(z), z = u^2, |u| <= tan(pi/8).
+            static double atan(double u)
+            {
+                double z = u * u;
+                double p = (((-8.750608600031904122785e-1 * z - 1.615753718733365076637e1) * z - 7.500855792314704667340e1) * z - 1.228866684490136173410e2) * z - 6.485021904942025371773e1;
+                double q = ((((z + 2.485846490142306297962e1) * z + 1.650270098316988542046e2) * z + 4.328810604912902668951e2) * z + 4.853903996359136964868e2) * z + 1.945506571482613964425e2;
+                return u + u * z * p / q;
+            }
+
+            /// sin(r) for |r| <= pi/4.
+            static double sin(double r)
+            {
+                double z = r * r;
+                double p = ((((1.58962301576546568060e-10 * z - 2.50507477628578072866e-8) * z + 2.75573136213857245213e-6) * z - 1.98412698295895385996e-4) * z + 8.33333333332211858878e-3) * z - 1.66666666666666307295e-1;
+                return r + r * z * p;
+            }
+
+            /// cos(r) for |r| <= pi/4.
+            static double cos(double r)
+            {
+                double z = r * r;
+                double p = ((((-1.13585365213876817300e-11 * z + 2.08757008419747316778e-9) * z - 2.75573141792967388112e-7) * z + 2.48015872888517045348e-5) * z - 1.38888888888730564116e-3) * z + 4.16666666666665929218e-2;
+                return 1.0 - 0.5 * z + z * z * p;
+            }
+
+            /// pi/2 split into three parts for an exact quadrant reduction.
+            static constexpr double HALF_PI[3] = {1.57079625129699707031e0, 7.54978941586159635335e-8, 5.39030285815811905290e-15};
+        };
+
+        template <>
+        struct PolarCoeffs<float>
+        {
+            static float atan(float u)
+            {
+                float z = u * u;
+                return (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * u + u;
+            }
+
+            static float sin(float r)
+            {
+                float z = r * r;
+                return ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+            }
+
+            static float cos(float r)
+            {
+                float z = r * r;
+                return 1.0f - 0.5f * z + z * z * ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f);
+            }
+
+            static constexpr float HALF_PI[3] = {1.5703125f, 4.837512969970703125e-4f, 7.54978995489188216e-8f};
+        };
+
+        /// Branch-free atan2(y, x); atan2(0, 0) is 0.
+        template <typename F>
+        inline F atan2Approx(F y, F x)
+        {
+            constexpr F PI = PI_V<F>, TAN_PI_8 = F(0.41421356237309504880);
+            F ax = std::fabs(x), ay = std::fabs(y);
+            bool swap = ay > ax;
+            F num = swap ? ax : ay, den = swap ? ay : ax;
+            F t = den > F(0) ? num / den : F(0);
+            bool big = t > TAN_PI_8;
+            F u = big ? (t - F(1)) / (t + F(1)) : t;
+            F r = (big ? PI / 4 : F(0)) + PolarCoeffs<F>::atan(u);
+            r = swap ? PI / 2 - r : r;
+            r = x < F(0) ? PI - r : r;
+            return std::copysign(r, y);
+        }
+
+        /// Rounds to the nearest integer by adding and removing 1.5 * 2^mantissa bits;
+        /// unlike std::nearbyint and std::floor this vectorizes without -fno-trapping-math.
+        template <typename F>
+        inline F roundNearest(F x)
+        {
+            constexpr F SHIFTER = F(1.5) * F(std::is_same_v<F, float> ? 8388608.0 : 4503599627370496.0);
+            return (x + SHIFTER) - SHIFTER;
+        }
+
+        /// Maps any finite angle into (-pi, pi]. Moderate angles are reduced with the
+        /// three-part pi / 2 split; std::remainder is only needed for huge ones.
+        template <typename F>
+        F reduceAngle(F a)
+        {
+            constexpr F INV_TWO_PI = F(0.15915494309189533577);
+            if (!(std::abs(a) < F(1e5)))
+            {
+                a = std::remainder(a, 2 * PI_V<F>);
+                return a == -PI_V<F> ? PI_V<F> : a;
+            }
+            F q = F(4) * roundNearest(a * INV_TWO_PI);
+            F r = ((a - q * PolarCoeffs<F>::HALF_PI[0]) - q * PolarCoeffs<F>::HALF_PI[1]) - q * PolarCoeffs<F>::HALF_PI[2];
+            return wrapAngle(r);
+        }
+
+        /// Branch-free sin and cos of a moderate angle (|a| well below 1e5).
+        template <typename F>
+        inline void sinCosApprox(F a, F &s, F &c)
+        {
+            constexpr F TWO_OVER_PI = F(0.63661977236758134308);
+            F q = roundNearest(a * TWO_OVER_PI);
+            F r = ((a - q * PolarCoeffs<F>::HALF_PI[0]) - q * PolarCoeffs<F>::HALF_PI[1]) - q * PolarCoeffs<F>::HALF_PI[2];
+            F sr = PolarCoeffs<F>::sin(r), cr = PolarCoeffs<F>::cos(r);
+            F quadrant = q - F(4) * roundNearest((q - F(1.5)) * F(0.25)); // q mod 4, in 0..3
+            bool odd = quadrant == F(1) || quadrant == F(3);
+            F sv = odd ? cr : sr, cv = odd ? sr : cr;
+            s = quadrant >= F(2) ? -sv : sv;
+            c = quadrant == F(1) || quadrant == F(2) ? -cv : cv;
+        }
+    }
+
+    /**
+     * @brief Complex number stored as magnitude and angle.
+     *
+     * @tparam F float or double.
+     */
+    template <typename F>
+    class PolarComplex
+    {
+        static_assert(std::is_floating_point_v<F>, "PolarComplex needs a floating-point component type");
+
+    private:
+        F mag = 0;   ///< Magnitude, >= 0
+        F angle = 0; ///< Angle in radians, in (-pi, pi]
+
+        struct Raw
+        {
+        };
+
+        /// Stores already normalized fields.
+        constexpr PolarComplex(F m, F a, Raw) noexcept : mag(m), angle(a) {}
+
+        /// Result of multiplying or dividing normalized values: m >= 0, a in (-2 pi, 2 pi].
+        static PolarComplex product(F m, F a)
+        {
+            return {m, m == F(0) ? F(0) : detail::wrapAngle(a), Raw{}};
+        }
+
+        /// Result of an operation whose angle lies in (-3 pi, 3 pi].
+        static PolarComplex make(F m, F a)
+        {
+            if (m == F(0))
+                return {};
+            if (m < F(0))
+            {
+                m = -m;
+                a += detail::PI_V<F>;
+            }
+            return {m, detail::wrapAngle(detail::wrapAngle(a)), Raw{}};
+        }
+
+    public:
+        using value_type = F;
+
+        // =========================
+        // Constructors
+        // =========================
+
+        /**
+         * @brief Default constructor. Creates zero.
+         */
+        constexpr PolarComplex() = default;
+
+        /**
+         * @brief Construct from magnitude and angle.
+         * @param magnitude Magnitude; a negative value adds pi to the angle.
+         * @param angle Angle in radians, reduced into (-pi, pi].
+         */
+        PolarComplex(F magnitude, F angle) : PolarComplex(make(magnitude, detail::reduceAngle(angle))) {}
+
+        /**
+         * @brief Converts a real number: angle 0, or pi if it is negative.
+         */
+        template <typename A, typename = std::enable_if_t<std::is_arithmetic_v<A>>>
+        explicit PolarComplex(A x) : PolarComplex(make(static_cast<F>(x), F(0)))
+        {
+        }
+
+        /**
+         * @brief Converts a rectangular complex number.
+         */
+        template <typename T, typename U>
+        explicit PolarComplex(const Complex<T, U> &c)
+        {
+            F re = static_cast<F>(c.getReal()), im = static_cast<F>(c.getImg());
+            mag = std::sqrt(re * re + im * im);
+            angle = mag == F(0) ? F(0) : std::atan2(im, re);
+            if (angle == -detail::PI_V<F>)
+                angle = detail::PI_V<F>;
+        }
+
+        /**
+         * @brief Wraps fields that are already normalized, without checking them.
+         * @param magnitude Magnitude, >= 0.
+         * @param angle Angle in (-pi, pi]; 0 when magnitude is 0.
+         */
+        static constexpr PolarComplex fromNormalized(F magnitude, F angle) noexcept
+        {
+            return PolarComplex(magnitude, angle, Raw{});
+        }
+
+        /**
+         * @brief Converts from another precision.
+         */
+        template <typename G>
+        explicit PolarComplex(const PolarComplex<G> &p) : mag(static_cast<F>(p.magnitude())), angle(static_cast<F>(p.argument()))
+        {
+        }
+
+        // =========================
+        // Accessors
+        // =========================
+
+        /// Magnitude; a field read.
+        constexpr F magnitude() const noexcept { return mag; }
+
+        /// Angle in radians, in (-pi, pi].
+        constexpr F argument() const noexcept { return angle; }
+
+        /// Magnitude as double, like Complex::getValue() but without a square root.
+        constexpr double getValue() const noexcept { return static_cast<double>(mag); }
+
+        /// Real part, magnitude * cos(angle).
+        F getReal() const { return mag * std::cos(angle); }
+
+        /// Imaginary part, magnitude * sin(angle).
+        F getImg() const { return mag * std::sin(angle); }
+
+        /// Rectangular form.
+        Complex<F, F> toComplex() const { return {getReal(), getImg()}; }
+
+        // =========================
+        // Arithmetic Operators
+        // =========================
+
+        /// Product: magnitudes multiply, angles add.
+        PolarComplex operator*(const PolarComplex &o) const { return product(mag * o.mag, angle + o.angle); }
+
+        /// Quotient: magnitudes divide, angles subtract. Division by zero gives an infinite magnitude.
+        PolarComplex operator/(const PolarComplex &o) const { return product(mag / o.mag, angle - o.angle); }
+
+        /// Sum, computed in rectangular form.
+        PolarComplex operator+(const PolarComplex &o) const { return PolarComplex(toComplex() + o.toComplex()); }
+
+        /// Difference, computed in rectangular form.
+        PolarComplex operator-(const PolarComplex &o) const { return PolarComplex(toComplex() - o.toComplex()); }
+
+        /// Negation: the angle turns by pi.
+        PolarComplex operator-() const { return make(mag, angle + detail::PI_V<F>); }
+
+        PolarComplex &operator*=(const PolarComplex &o) { return *this = *this * o; }
+        PolarComplex &operator/=(const PolarComplex &o) { return *this = *this / o; }
+        PolarComplex &operator+=(const PolarComplex &o) { return *this = *this + o; }
+        PolarComplex &operator-=(const PolarComplex &o) { return *this = *this - o; }
+
+        /// Complex conjugate: the angle changes sign.
+        PolarComplex conj() const { return make(mag, angle == detail::PI_V<F> ? angle : -angle); }
+
+        // =========================
+        // Comparison Operators
+        // =========================
+
+        /// Orders by magnitude, like Complex::operator<.
+        constexpr bool operator<(const PolarComplex &o) const noexcept { return mag < o.mag; }
+        constexpr bool operator>(const PolarComplex &o) const noexcept { return mag > o.mag; }
+        constexpr bool operator<=(const PolarComplex &o) const noexcept { return mag <= o.mag; }
+        constexpr bool operator>=(const PolarComplex &o) const noexcept { return mag >= o.mag; }
+
+        /// Equal when magnitude and angle are equal.
+        constexpr bool operator==(const PolarComplex &o) const noexcept { return mag == o.mag && angle == o.angle; }
+        constexpr bool operator!=(const PolarComplex &o) const noexcept { return !(*this == o); }
+
+        // =========================
+        // I/O Operators
+        // =========================
+
+        /**
+         * @brief Prints magnitude and angle, e.g. (5, 0.927295 rad).
+         */
+        friend std::ostream &operator<<(std::ostream &os, const PolarComplex &p)
+        {
+            return os << "(" << p.mag << ", " << p.angle << " rad)";
+        }
+
+        /**
+         * @brief Reads magnitude and angle in radians, separated by whitespace.
+         */
+        friend std::istream &operator>>(std::istream &is, PolarComplex &p)
+        {
+            F m, a;
+            if (is >> m >> a)
+                p = PolarComplex(m, a);
+            return is;
+        }
+    };
+
+    /**
+     * @brief z^p for a real exponent: magnitude^p and angle * p.
+     *        Picks the principal branch, so pow(z, 0.5) has angle in (-pi/2, pi/2].
+     */
+    template <typename F>
+    PolarComplex<F> pow(const PolarComplex<F> &z, F p)
+    {
+        return PolarComplex<F>(std::pow(z.magnitude(), p), z.argument() * p);
+    }
+
+    /**
+     * @brief z^n for an integer exponent: the magnitude by repeated squaring, the angle
+     *        multiplied by n. Cheaper than the real-exponent overload, which calls std::pow.
+     */
+    template <typename F>
+    PolarComplex<F> pow(const PolarComplex<F> &z, int n)
+    {
+        F base = z.magnitude(), m = F(1);
+        for (unsigned e = n < 0 ? 0u - static_cast<unsigned>(n) : static_cast<unsigned>(n); e != 0; e >>= 1)
+        {
+            if (e & 1u)
+                m *= base;
+            base *= base;
+        }
+        if (n < 0)
+            m = F(1) / m;
+        F a = m == F(0) ? F(0) : detail::reduceAngle(z.argument() * static_cast<F>(n));
+        return PolarComplex<F>::fromNormalized(m, a);
+    }
+
+    // =========================
+    // Batch Conversion
+    // =========================
+
+    /**
+     * @brief Rectangular to polar on split arrays: mag[i], angle[i] from re[i], im[i].
+     *        Outputs may alias the inputs.
+     */
+    template <typename F>
+    void toPolar(const F *re, const F *im, F *mag, F *angle, std::size_t n)
+    {
+        F a[POLAR_BLOCK];
+        for (std::size_t base = 0; base < n; base += POLAR_BLOCK)
+        {
+            std::size_t cnt = std::min(POLAR_BLOCK, n - base);
+            for (std::size_t j = 0; j < cnt; ++j)
+                a[j] = detail::atan2Approx(im[base + j], re[base + j]);
+            simd::magnitude(re + base, im + base, mag + base, cnt);
+            for (std::size_t j = 0; j < cnt; ++j)
+            {
+                F m = mag[base + j];
+                angle[base + j] = m == F(0) ? F(0) : a[j] == -detail::PI_V<F> ? detail::PI_V<F> : a[j];
+            }
+        }
+    }
+
+    /**
+     * @brief Polar to rectangular on split arrays: re[i], im[i] from mag[i], angle[i].
+     *        Outputs may alias the inputs.
+     */
+    template <typename F>
+    void toRect(const F *mag, const F *angle, F *re, F *im, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            F s, c, m = mag[i];
+            detail::sinCosApprox(angle[i], s, c);
+            re[i] = m * c;
+            im[i] = m * s;
+        }
+    }
+
+    /**
+     * @brief out[i] = PolarComplex(in[i]) for i in [0, n), vectorized.
+     */
+    template <typename F>
+    void toPolar(const Complex<F, F> *in, PolarComplex<F> *out, std::size_t n)
+    {
+        F a[POLAR_BLOCK], b[POLAR_BLOCK];
+        for (std::size_t base = 0; base < n; base += POLAR_BLOCK)
+        {
+            std::size_t cnt = std::min(POLAR_BLOCK, n - base);
+            for (std::size_t j = 0; j < cnt; ++j)
+            {
+                a[j] = in[base + j].getReal();
+                b[j] = in[base + j].getImg();
+            }
+            toPolar(a, b, a, b, cnt);
+            for (std::size_t j = 0; j < cnt; ++j)
+                out[base + j] = PolarComplex<F>::fromNormalized(a[j], b[j]);
+        }
+    }
+
+    /**
+     * @brief out[i] = in[i].toComplex() for i in [0, n), vectorized.
+     */
+    template <typename F>
+    void toRect(const PolarComplex<F> *in, Complex<F, F> *out, std::size_t n)
+    {
+        F a[POLAR_BLOCK], b[POLAR_BLOCK];
+        for (std::size_t base = 0; base < n; base += POLAR_BLOCK)
+        {
+            std::size_t cnt = std::min(POLAR_BLOCK, n - base);
+            for (std::size_t j = 0; j < cnt; ++j)
+            {
+                a[j] = in[base + j].magnitude();
+                b[j] = in[base + j].argument();
+            }
+            toRect(a, b, a, b, cnt);
+            for (std::size_t j = 0; j < cnt; ++j)
+                out[base + j] = Complex<F, F>(a[j], b[j]);
+        }
+    }
+}
@@ -0,0 +1,660 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "Parallel.hpp"
+#include "Type.hpp"
+
+/**
+ * @file Polynomial.hpp
+ * @brief Polynomials with real or complex coefficients, evaluated over arrays
+ *        of points, and a batched Aberth root finder.
+ *
+ * @code
+ * Polynomial<double> p{-6.0, 11.0, -6.0, 1.0};   // (x-1)(x-2)(x-3), lowest power first
+ * p.evaluate(x, y, n);                           // y[i] = p(x[i]) for n points
+ * auto roots = findRoots(Parallel{}, polys);     // roots of every polynomial in polys
+ * @endcode
+ *
+ * Batch evaluation works on blocks of EVAL_BLOCK points held as separate real
+ * and imaginary arrays. Each Horner step is then one multiply-add over the
+ * whole block, which the compiler turns into packed FMAs, and the 64
+ * independent points hide the latency that serializes a single Horner chain.
+ * Scheme::Estrin evaluates pairs of terms and then combines them with x^2,
+ * x^4, ..., so the dependency chain has log2(n) steps instead of n. That only
+ * pays off for short batches of high degree: over full blocks the points
+ * already give independent chains, and Horner, with fewer operations and no
+ * scratch arrays, is about twice as fast.
+ *
+ * findRoots() runs the Aberth-Ehrlich iteration on many polynomials at once.
+ * Polynomials of equal degree are grouped into batches of ROOT_BATCH, stored
+ * with one lane per polynomial, and every update is a loop over the lanes.
+ * A polynomial whose roots have all stopped moving is frozen while the rest of
+ * its batch continues. Simple roots converge cubically; multiple roots
+ * converge linearly and are accurate to about eps^(1/multiplicity).
+ */
+
+namespace myStd
+{
+    /// Points per block in batch evaluation.
+    constexpr std::size_t EVAL_BLOCK = 64;
+
+    /// Polynomials per lane group in findRoots.
+    constexpr std::size_t ROOT_BATCH = 64;
+
+    /**
+     * @brief Evaluation order for batches of points.
+     */
+    enum class Scheme
+    {
+        Horner, ///< n multiply-adds in one chain; fewest operations
+        Estrin  ///< Pairwise tree of depth log2(n); shorter dependency chain
+    };
+
+    namespace detail
+    {
+        /// Component type of a coefficient type: F for F and for Complex<F, F>.
+        template <typename T>
+        struct polyReal
+        {
+            using type = T;
+        };
+
+        template <typename F>
+        struct polyReal<Complex<F, F>>
+        {
+            using type = F;
+        };
+    }
+
+    /**
+     * @brief Polynomial c0 + c1 x + ... + cn x^n with coefficients stored as
+     *        separate real and imaginary arrays.
+     *
+     * @tparam T float, double or Complex<F, F> with F float or double.
+     */
+    template <typename T>
+    class Polynomial
+    {
+    public:
+        using real_type = typename detail::polyReal<T>::type;
+        using complex_type = Complex<real_type, real_type>;
+
+    private:
+        static_assert(std::is_floating_point_v<real_type>, "Polynomial needs floating-point or Complex<F, F> coefficients");
+        static constexpr bool COMPLEX = is_complex_v<T>;
+
+        std::vector<real_type> re; ///< Real parts, lowest power first
+        std::vector<real_type> im; ///< Imaginary parts; empty for real T
+
+        /// Drops zero leading coefficients, keeping at least the constant term.
+        void trim()
+        {
+            while (re.size() > 1 && re.back() == real_type(0) && (!COMPLEX || im.back() == real_type(0)))
+            {
+                re.pop_back();
+                if constexpr (COMPLEX)
+                    im.pop_back();
+            }
+            if (re.empty())
+            {
+                re.push_back(real_type(0));
+                if constexpr (COMPLEX)
+                    im.push_back(real_type(0));
+            }
+        }
+
+        /// Horner over one block of cnt points with split real and imaginary parts.
+        template <bool XC>
+        void hornerBlock(const real_type *xr, const real_type *xi, real_type *ar, real_type *ai, std::size_t cnt) const
+        {
+            constexpr bool RC = XC || COMPLEX;
+            std::size_t n = degree();
+            for (std::size_t j = 0; j < cnt; ++j)
+            {
+                ar[j] = re[n];
+                if constexpr (RC)
+                    ai[j] = COMPLEX ? im[n] : real_type(0);
+            }
+            for (std::size_t k = n; k-- > 0;)
+            {
+                real_type cr = re[k], ci = COMPLEX ? im[k] : real_type(0);
+                for (std::size_t j = 0; j < cnt; ++j)
+                {
+                    if constexpr (XC)
+                    {
+                        real_type t = ar[j] * xr[j] - ai[j] * xi[j] + cr;
+                        ai[j] = ar[j] * xi[j] + ai[j] * xr[j] + ci;
+                        ar[j] = t;
+                    }
+                    else
+                    {
+                        ar[j] = ar[j] * xr[j] + cr;
+                        if constexpr (RC)
+                            ai[j] = ai[j] * xr[j] + ci;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Estrin over one block: pairs c[2i] + c[2i+1] x, then pairs of
+         *        those with x^2, x^4, ... until one term is left in tr/ti[0..cnt).
+         * @param tr, ti Scratch of (degree() / 2 + 1) * EVAL_BLOCK values each.
+         */
+        template <bool XC>
+        void estrinBlock(const real_type *xr, const real_type *xi, real_type *tr, real_type *ti, std::size_t cnt) const
+        {
+            constexpr bool RC = XC || COMPLEX;
+            constexpr std::size_t B = EVAL_BLOCK;
+            std::size_t n = degree(), m = n / 2 + 1;
+
+            for (std::size_t i = 0; i < m; ++i)
+            {
+                real_type c0r = re[2 * i], c0i = COMPLEX ? im[2 * i] : real_type(0);
+                bool odd = 2 * i + 1 <= n;
+                real_type c1r = odd ? re[2 * i + 1] : real_type(0);
+                real_type c1i = odd && COMPLEX ? im[2 * i + 1] : real_type(0);
+                real_type *dr = tr + i * B, *di = ti + i * B;
+                for (std::size_t j = 0; j < cnt; ++j)
+                {
+                    if constexpr (XC)
+                    {
+                        dr[j] = c0r + c1r * xr[j] - c1i * xi[j];
+                        di[j] = c0i + c1r * xi[j] + c1i * xr[j];
+                    }
+                    else
+                    {
+                        dr[j] = c0r + c1r * xr[j];
+                        if constexpr (RC)
+                            di[j] = c0i + c1i * xr[j];
+                    }
+                }
+            }
+
+            real_type pr[B], pi[B];
+            for (std::size_t j = 0; j < cnt; ++j)
+            {
+                if constexpr (XC)
+                {
+                    pr[j] = xr[j] * xr[j] - xi[j] * xi[j];
+                    pi[j] = 2 * xr[j] * xi[j];
+                }
+                else
+                    pr[j] = xr[j] * xr[j];
+            }
+
+            while (m > 1)
+            {
+                for (std::size_t i = 0; 2 * i + 1 < m; ++i)
+                {
+                    real_type *dr = tr + i * B, *di = ti + i * B;
+                    const real_type *lr = tr + 2 * i * B, *li = ti + 2 * i * B;
+                    const real_type *hr = lr + B, *hi = li + B;
+                    for (std::size_t j = 0; j < cnt; ++j)
+                    {
+                        if constexpr (XC)
+                        {
+                            real_type r = lr[j] + hr[j] * pr[j] - hi[j] * pi[j];
+                            di[j] = li[j] + hr[j] * pi[j] + hi[j] * pr[j];
+                            dr[j] = r;
+                        }
+                        else
+                        {
+                            dr[j] = lr[j] + hr[j] * pr[j];
+                            if constexpr (RC)
+                                di[j] = li[j] + hi[j] * pr[j];
+                        }
+                    }
+                }
+                if (m % 2)
+                {
+                    std::copy(tr + (m - 1) * B, tr + (m - 1) * B + cnt, tr + (m / 2) * B);
+                    if constexpr (RC)
+                        std::copy(ti + (m - 1) * B, ti + (m - 1) * B + cnt, ti + (m / 2) * B);
+                }
+                m = (m + 1) / 2;
+                if (m > 1)
+                    for (std::size_t j = 0; j < cnt; ++j)
+                    {
+                        if constexpr (XC)
+                        {
+                            real_type r = pr[j] * pr[j] - pi[j] * pi[j];
+                            pi[j] = 2 * pr[j] * pi[j];
+                            pr[j] = r;
+                        }
+                        else
+                            pr[j] = pr[j] * pr[j];
+                    }
+            }
+        }
+
+    public:
+        // =========================
+        // Constructors
+        // =========================
+
+        /**
+         * @brief Default constructor. Creates the zero polynomial.
+         */
+        Polynomial() : Polynomial(std::vector<T>{}) {}
+
+        /**
+         * @brief Construct from coefficients, lowest power first.
+         */
+        Polynomial(std::initializer_list<T> coeffs) : Polynomial(std::vector<T>(coeffs)) {}
+
+        /**
+         * @brief Construct from coefficients, lowest power first.
+         */
+        explicit Polynomial(const std::vector<T> &coeffs)
+        {
+            re.reserve(coeffs.size());
+            for (const T &c : coeffs)
+            {
+                if constexpr (COMPLEX)
+                {
+                    re.push_back(c.getReal());
+                    im.push_back(c.getImg());
+                }
+                else
+                    re.push_back(c);
+            }
+            trim();
+        }
+
+        /**
+         * @brief Builds a polynomial from n Type<T> coefficients, lowest power first.
+         */
+        static Polynomial fromTypes(const Type<T> *coeffs, std::size_t n)
+        {
+            std::vector<T> values(n);
+            for (std::size_t i = 0; i < n; ++i)
+                values[i] = coeffs[i].get();
+            return Polynomial(values);
+        }
+
+        // =========================
+        // Coefficient Access
+        // =========================
+
+        /**
+         * @brief Index of the highest nonzero coefficient; 0 for constants.
+         */
+        std::size_t degree() const { return re.size() - 1; }
+
+        /**
+         * @brief Coefficient of x^k; zero above the degree.
+         */
+        T coefficient(std::size_t k) const
+        {
+            if (k >= re.size())
+                return T{};
+            if constexpr (COMPLEX)
+                return T(re[k], im[k]);
+            else
+                return re[k];
+        }
+
+        /**
+         * @brief Returns the derivative.
+         */
+        Polynomial derivative() const
+        {
+            std::vector<T> d;
+            for (std::size_t k = 1; k < re.size(); ++k)
+            {
+                real_type s = static_cast<real_type>(k);
+                if constexpr (COMPLEX)
+                    d.push_back(T(re[k] * s, im[k] * s));
+                else
+                    d.push_back(re[k] * s);
+            }
+            return Polynomial(d);
+        }
+
+        // =========================
+        // Evaluation
+        // =========================
+
+        /**
+         * @brief Value at one point by Horner's rule.
+         * @param x real_type or complex_type.
+         * @return real_type for real T and real x, complex_type otherwise.
+         */
+        template <typename X>
+        auto operator()(X x) const
+        {
+            constexpr bool XC = is_complex_v<X>;
+            using Out = std::conditional_t<XC || COMPLEX, complex_type, real_type>;
+            real_type xr, xi = 0, ar, ai = 0;
+            if constexpr (XC)
+            {
+                xr = x.getReal();
+                xi = x.getImg();
+            }
+            else
+                xr = static_cast<real_type>(x);
+            hornerBlock<XC>(&xr, &xi, &ar, &ai, 1);
+            if constexpr (std::is_same_v<Out, complex_type>)
+                return Out(ar, ai);
+            else
+                return ar;
+        }
+
+        /**
+         * @brief out[i] = p(x[i]) for i in [0, n).
+         * @param policy Sequential or Parallel.
+         * @param x Points: real_type or complex_type.
+         * @param out Results: real_type when both x and T are real, complex_type otherwise.
+         * @param scheme Horner or Estrin.
+         */
+        template <typename Policy, typename X, typename Out>
+        void evaluate(const Policy &policy, const X *x, Out *out, std::size_t n, Scheme scheme = Scheme::Horner) const
+        {
+            constexpr bool XC = is_complex_v<X>;
+            constexpr bool RC = XC || COMPLEX;
+            static_assert(std::is_same_v<X, real_type> || std::is_same_v<X, complex_type>, "points must be real_type or complex_type");
+            static_assert(std::is_same_v<Out, std::conditional_t<RC, complex_type, real_type>>, "output must be complex_type when x or the coefficients are complex");
+
+            std::size_t grain = std::max(EVAL_BLOCK, detail::grainFor<X>(policy) / EVAL_BLOCK * EVAL_BLOCK);
+            detail::forBlocks(policy, n, grain, [&](std::size_t begin, std::size_t end)
+                              {
+                constexpr std::size_t B = EVAL_BLOCK;
+                std::vector<real_type> scratch;
+                if (scheme == Scheme::Estrin)
+                    scratch.resize(2 * (degree() / 2 + 1) * B);
+                real_type xr[B], xi[B], ar[B], ai[B];
+                for (std::size_t b = begin; b < end; b += B)
+                {
+                    std::size_t cnt = std::min(B, end - b);
+                    for (std::size_t j = 0; j < cnt; ++j)
+                    {
+                        if constexpr (XC)
+                        {
+                            xr[j] = x[b + j].getReal();
+                            xi[j] = x[b + j].getImg();
+                        }
+                        else
+                            xr[j] = x[b + j];
+                    }
+                    const real_type *rr = ar, *ri = ai;
+                    if (scheme == Scheme::Estrin)
+                    {
+                        real_type *tr = scratch.data(), *ti = tr + scratch.size() / 2;
+                        estrinBlock<XC>(xr, xi, tr, ti, cnt);
+                        rr = tr;
+                        ri = ti;
+                    }
+                    else
+                        hornerBlock<XC>(xr, xi, ar, ai, cnt);
+                    for (std::size_t j = 0; j < cnt; ++j)
+                    {
+                        if constexpr (RC)
+                            out[b + j] = complex_type(rr[j], ri[j]);
+                        else
+                            out[b + j] = rr[j];
+                    }
+                } });
+        }
+
+        /**
+         * @brief out[i] = p(x[i]) for i in [0, n), on the calling thread.
+         */
+        template <typename X, typename Out>
+        void evaluate(const X *x, Out *out, std::size_t n, Scheme scheme = Scheme::Horner) const
+        {
+            evaluate(Sequential{}, x, out, n, scheme);
+        }
+
+        /**
+         * @brief Returns the degree() complex roots; see findRoots().
+         */
+        std::vector<complex_type> roots(unsigned maxIterations = 100) const;
+
+        // =========================
+        // I/O Operators
+        // =========================
+
+        /**
+         * @brief Prints the nonzero terms, e.g. 1 + 2*x^1 + 3*x^2.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const Polynomial &p)
+        {
+            bool first = true;
+            for (std::size_t k = 0; k <= p.degree(); ++k)
+            {
+                T c = p.coefficient(k);
+                if (!(c == T{}) || (k == 0 && p.degree() == 0))
+                {
+                    os << (first ? "" : " + ") << c;
+                    if (k)
+                        os << "*x^" << k;
+                    first = false;
+                }
+            }
+            return os;
+        }
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Aberth-Ehrlich iteration on L polynomials of degree n, one per lane.
+         *
+         * @param cr, ci Monic coefficients a[k * L + l] of x^k, k < n, for lane l.
+         * @param zr, zi Roots z[k * L + l]; start values in, roots out.
+         */
+        template <typename F>
+        void aberthBatch(std::size_t n, std::size_t L, const F *cr, const F *ci, F *zr, F *zi, unsigned maxIterations)
+        {
+            const F tol2 = F(16) * std::numeric_limits<F>::epsilon() * std::numeric_limits<F>::epsilon();
+            std::vector<F> buf(7 * L);
+            F *pr = buf.data(), *pi = pr + L, *dr = pi + L, *di = dr + L, *sr = di + L, *si = sr + L, *step = si + L;
+            std::vector<char> done(L, 0);
+
+            for (unsigned it = 0; it < maxIterations; ++it)
+            {
+                std::fill(step, step + L, F(0));
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    F *xr = zr + k * L, *xi = zi + k * L;
+
+                    // p(z) and p'(z) of the monic polynomial by Horner.
+                    std::fill(pr, pr + L, F(1));
+                    std::fill(pi, pi + L, F(0));
+                    std::fill(dr, dr + L, F(0));
+                    std::fill(di, di + L, F(0));
+                    for (std::size_t j = n; j-- > 0;)
+                        for (std::size_t l = 0; l < L; ++l)
+                        {
+                            F t = dr[l] * xr[l] - di[l] * xi[l] + pr[l];
+                            di[l] = dr[l] * xi[l] + di[l] * xr[l] + pi[l];
+                            dr[l] = t;
+                            t = pr[l] * xr[l] - pi[l] * xi[l] + cr[j * L + l];
+                            pi[l] = pr[l] * xi[l] + pi[l] * xr[l] + ci[j * L + l];
+                            pr[l] = t;
+                        }
+
+                    // s = sum over j != k of 1 / (z_k - z_j).
+                    std::fill(sr, sr + L, F(0));
+                    std::fill(si, si + L, F(0));
+                    for (std::size_t j = 0; j < n; ++j)
+                    {
+                        if (j == k)
+                            continue;
+                        const F *yr = zr + j * L, *yi = zi + j * L;
+                        for (std::size_t l = 0; l < L; ++l)
+                        {
+                            F ur = xr[l] - yr[l], ui = xi[l] - yi[l];
+                            F d = ur * ur + ui * ui;
+                            F inv = d > F(0) ? F(1) / d : F(0);
+                            sr[l] += ur * inv;
+                            si[l] -= ui * inv;
+                        }
+                    }
+
+                    // w = p / p', z -= w / (1 - w s).
+                    for (std::size_t l = 0; l < L; ++l)
+                    {
+                        F d = dr[l] * dr[l] + di[l] * di[l];
+                        F inv = d > F(0) ? F(1) / d : F(0);
+                        F wr = (pr[l] * dr[l] + pi[l] * di[l]) * inv;
+                        F wi = (pi[l] * dr[l] - pr[l] * di[l]) * inv;
+                        F er = F(1) - (wr * sr[l] - wi * si[l]);
+                        F ei = -(wr * si[l] + wi * sr[l]);
+                        F e = er * er + ei * ei;
+                        F einv = e > F(0) ? F(1) / e : F(0);
+                        F qr = e > F(0) ? (wr * er + wi * ei) * einv : wr;
+                        F qi = e > F(0) ? (wi * er - wr * ei) * einv : wi;
+                        if (done[l])
+                            qr = qi = F(0);
+                        xr[l] -= qr;
+                        xi[l] -= qi;
+                        F mag = xr[l] * xr[l] + xi[l] * xi[l];
+                        F rel = (qr * qr + qi * qi) / (mag > F(0) ? mag : F(1));
+                        step[l] = std::max(step[l], rel);
+                    }
+                }
+
+                bool all = true;
+                for (std::size_t l = 0; l < L; ++l)
+                {
+                    if (step[l] <= tol2 || !(step[l] == step[l]))
+                        done[l] = 1;
+                    all = all && done[l];
+                }
+                if (all)
+                    break;
+            }
+        }
+
+        /// Normalizes polys[idx[0..L)] (all of degree n) to monic, seeds a circle of start values and runs aberthBatch.
+        template <typename T>
+        void rootsBatch(const std::vector<Polynomial<T>> &polys, const std::size_t *idx, std::size_t L, std::size_t n,
+                        std::vector<std::vector<typename Polynomial<T>::complex_type>> &out, unsigned maxIterations)
+        {
+            using F = typename Polynomial<T>::real_type;
+            using C = typename Polynomial<T>::complex_type;
+            constexpr F TWO_PI = F(6.283185307179586476925286766559);
+            std::vector<F> cr(n * L), ci(n * L), zr(n * L), zi(n * L);
+
+            for (std::size_t l = 0; l < L; ++l)
+            {
+                const Polynomial<T> &p = polys[idx[l]];
+                auto coefficient = [&](std::size_t k)
+                {
+                    T c = p.coefficient(k);
+                    if constexpr (is_complex_v<T>)
+                        return C(c.getReal(), c.getImg());
+                    else
+                        return C(c, F(0));
+                };
+                C lead = coefficient(n);
+                F lr = lead.getReal(), li = lead.getImg(), ld = lr * lr + li * li;
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    C c = coefficient(k);
+                    cr[k * L + l] = (c.getReal() * lr + c.getImg() * li) / ld;
+                    ci[k * L + l] = (c.getImg() * lr - c.getReal() * li) / ld;
+                }
+                // Start on a circle whose radius is the geometric mean of the root moduli.
+                F r = std::pow(std::hypot(cr[l], ci[l]), F(1) / static_cast<F>(n));
+                if (!(r > F(0)) || !std::isfinite(r))
+                    r = F(1);
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    F angle = TWO_PI * static_cast<F>(k) / static_cast<F>(n) + F(0.4);
+                    zr[k * L + l] = r * std::cos(angle);
+                    zi[k * L + l] = r * std::sin(angle);
+                }
+            }
+
+            aberthBatch(n, L, cr.data(), ci.data(), zr.data(), zi.data(), maxIterations);
+
+            for (std::size_t l = 0; l < L; ++l)
+            {
+                auto &roots = out[idx[l]];
+                roots.resize(n);
+                for (std::size_t k = 0; k < n; ++k)
+                    roots[k] = C(zr[k * L + l], zi[k * L + l]);
+            }
+        }
+    }
+
+    // =========================
+    // Root Finding
+    // =========================
+
+    /**
+     * @brief Complex roots of every polynomial, with multiplicity.
+     *
+     * Polynomials are grouped by degree and solved ROOT_BATCH at a time with
+     * the Aberth-Ehrlich iteration; with a Parallel policy the batches run on
+     * the pool. Iteration stops for a polynomial once no root moves by more
+     * than about 4 eps relative to its modulus, or after maxIterations sweeps,
+     * in which case the current estimates are returned.
+     *
+     * @param policy Sequential or Parallel.
+     * @param polys Polynomials; constants have no roots.
+     * @param maxIterations Upper bound on Aberth sweeps per batch.
+     * @return roots[i] holds the polys[i].degree() roots of polys[i], in no particular order.
+     * @throws std::runtime_error if a polynomial is identically zero.
+     */
+    template <typename Policy, typename T>
+    std::vector<std::vector<typename Polynomial<T>::complex_type>> findRoots(const Policy &policy, const std::vector<Polynomial<T>> &polys, unsigned maxIterations = 100)
+    {
+        std::map<std::size_t, std::vector<std::size_t>> byDegree;
+        for (std::size_t i = 0; i < polys.size(); ++i)
+        {
+            if (polys[i].degree() == 0 && polys[i].coefficient(0) == T{})
+                throw(std::runtime_error("Zero polynomial has no finite set of roots!"));
+            if (polys[i].degree() > 0)
+                byDegree[polys[i].degree()].push_back(i);
+        }
+
+        struct Batch
+        {
+            std::size_t degree;
+            const std::size_t *idx;
+            std::size_t count;
+        };
+        std::vector<Batch> batches;
+        for (const auto &group : byDegree)
+            for (std::size_t b = 0; b < group.second.size(); b += ROOT_BATCH)
+                batches.push_back({group.first, group.second.data() + b, std::min(ROOT_BATCH, group.second.size() - b)});
+
+        std::vector<std::vector<typename Polynomial<T>::complex_type>> out(polys.size());
+        detail::forBlocks(policy, batches.size(), 1, [&](std::size_t begin, std::size_t end)
+                          {
+            for (std::size_t b = begin; b < end; ++b)
+                detail::rootsBatch(polys, batches[b].idx, batches[b].count, batches[b].degree, out, maxIterations); });
+        return out;
+    }
+
+    /**
+     * @brief Complex roots of every polynomial, on the calling thread.
+     */
+    template <typename T>
+    std::vector<std::vector<typename Polynomial<T>::complex_type>> findRoots(const std::vector<Polynomial<T>> &polys, unsigned maxIterations = 100)
+    {
+        return findRoots(Sequential{}, polys, maxIterations);
+    }
+
+    template <typename T>
+    std::vector<typename Polynomial<T>::complex_type> Polynomial<T>::roots(unsigned maxIterations) const
+    {
+        return findRoots(Sequential{}, std::vector<Polynomial>{*this}, maxIterations).front();
+    }
+}
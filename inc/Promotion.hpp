@@ -0,0 +1,206 @@
+#pragma once
+#include <stdexcept>
+#include <type_traits>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "Polar.hpp"
+#include "BigInt.hpp"
+
+namespace myStd
+{
+    /**
+     * @brief Statically dispatched arithmetic on raw values.
+     *
+     * These functions apply the same promotion rules as Type<T>'s polymorphic
+     * operators, but the operand types are known at compile time, so there is
+     * no virtual call, no dynamic_cast and no heap-allocated result. The result
+     * type is promote_t<L, R> (see Utils.hpp):
+     *  - same type            -> same type
+     *  - complex op anything  -> Complex<F, F>, real part combined with the other operand's value
+     *  - arithmetic op complex-> Complex<F, F>, complex real part combined with the arithmetic value
+     *  - BigInt op integer     -> BigInt, exact
+     *  - polar op anything    -> PolarComplex<F>, true complex arithmetic on both operands
+     *                            converted to polar form, so mul and div are allowed
+     *  - mixed real types     -> double, or float / the wider fixed-point type between narrow types
+     * where F is float when both operands are narrow (float, Complex<float, float>,
+     * PolarComplex<float>, Q15, Q31) and double otherwise. Mixed operations are computed in the result
+     * type, so narrow operands never take a detour through double.
+     *
+     * All functions are constexpr; they are constant expressions whenever no
+     * complex magnitude (which needs std::sqrt) or polar operand is involved.
+     */
+    namespace ops
+    {
+        /**
+         * @brief Returns the value as double. For complex and polar types, returns the magnitude.
+         * @param v Value to convert.
+         * @return Value as double.
+         */
+        template <typename T>
+        constexpr double valueOf(const T &v)
+        {
+            if constexpr (is_complex_v<T> || is_polar_v<T>)
+                return v.getValue();
+            else
+                return static_cast<double>(v);
+        }
+
+        /**
+         * @brief Converts a real operand to the real type R a mixed operation is computed in.
+         *        Complex and polar values contribute their magnitude.
+         * @param v Value to convert.
+         * @return v as R.
+         */
+        template <typename R, typename T>
+        constexpr R as(const T &v)
+        {
+            if constexpr (std::is_same_v<R, T>)
+                return v;
+            else if constexpr (is_complex_v<T> || is_polar_v<T>)
+                return static_cast<R>(v.getValue());
+            else
+                return static_cast<R>(v);
+        }
+
+        namespace detail
+        {
+            /// Real type a promoted result is computed in: F for Complex<F, F>, the type itself otherwise.
+            template <typename P>
+            struct realOf
+            {
+                using type = P;
+            };
+
+            template <typename T, typename U>
+            struct realOf<Complex<T, U>>
+            {
+                using type = T;
+            };
+
+            template <typename F>
+            struct realOf<PolarComplex<F>>
+            {
+                using type = F;
+            };
+
+            /// Converts any operand to PolarComplex<F>: complex values keep their phase, real values get angle 0 or pi.
+            template <typename F, typename T>
+            PolarComplex<F> toPolar(const T &v)
+            {
+                if constexpr (is_polar_v<T> || is_complex_v<T>)
+                    return PolarComplex<F>(v);
+                else
+                    return PolarComplex<F>(as<F>(v));
+            }
+        }
+
+        /**
+         * @brief Addition with Type<T> promotion rules.
+         * @param a Left operand.
+         * @param b Right operand.
+         * @return Sum, promoted as described above.
+         */
+        template <typename L, typename R>
+        constexpr promote_t<L, R> add(const L &a, const R &b)
+        {
+            using P = promote_t<L, R>;
+            using F = typename detail::realOf<P>::type;
+            if constexpr (std::is_same_v<L, R>)
+                return a + b;
+            else if constexpr (is_polar_v<P>)
+                return detail::toPolar<F>(a) + detail::toPolar<F>(b);
+            else if constexpr (is_complex_v<L>)
+                return {static_cast<F>(a.getReal()) + as<F>(b), static_cast<F>(a.getImg())};
+            else if constexpr (is_complex_v<R>)
+                return {static_cast<F>(b.getReal()) + as<F>(a), static_cast<F>(b.getImg())};
+            else
+                return as<P>(a) + as<P>(b);
+        }
+
+        /**
+         * @brief Subtraction with Type<T> promotion rules.
+         * @param a Left operand.
+         * @param b Right operand.
+         * @return Difference, promoted as described above.
+         */
+        template <typename L, typename R>
+        constexpr promote_t<L, R> sub(const L &a, const R &b)
+        {
+            using P = promote_t<L, R>;
+            using F = typename detail::realOf<P>::type;
+            if constexpr (std::is_same_v<L, R>)
+                return a - b;
+            else if constexpr (is_polar_v<P>)
+                return detail::toPolar<F>(a) - detail::toPolar<F>(b);
+            else if constexpr (is_complex_v<L>)
+                return {static_cast<F>(a.getReal()) - as<F>(b), static_cast<F>(a.getImg())};
+            else if constexpr (is_complex_v<R>)
+                return {static_cast<F>(b.getReal()) - as<F>(a), static_cast<F>(b.getImg())};
+            else
+                return as<P>(a) - as<P>(b);
+        }
+
+        /**
+         * @brief Multiplication with Type<T> promotion rules. Rectangular complex operands are rejected at
+         *        compile time unless the other operand is polar.
+         * @param a Left operand.
+         * @param b Right operand.
+         * @return Product.
+         */
+        template <typename L, typename R>
+        constexpr promote_t<L, R> mul(const L &a, const R &b)
+        {
+            static_assert(!rejects_mul_div_v<L, R>,
+                          "Can't do this operation for complex numbers");
+            if constexpr (std::is_same_v<L, R>)
+                return a * b;
+            else if constexpr (is_polar_v<promote_t<L, R>>)
+            {
+                using F = typename detail::realOf<promote_t<L, R>>::type;
+                return detail::toPolar<F>(a) * detail::toPolar<F>(b);
+            }
+            else
+                return as<promote_t<L, R>>(a) * as<promote_t<L, R>>(b);
+        }
+
+        /**
+         * @brief Division with Type<T> promotion rules. Rectangular complex operands are rejected at
+         *        compile time unless the other operand is polar.
+         * @param a Left operand.
+         * @param b Right operand.
+         * @return Quotient.
+         */
+        template <typename L, typename R>
+        constexpr promote_t<L, R> div(const L &a, const R &b)
+        {
+            static_assert(!rejects_mul_div_v<L, R>,
+                          "Can't do this operation for complex numbers");
+            if constexpr (std::is_same_v<L, R>)
+                return a / b;
+            else if constexpr (is_polar_v<promote_t<L, R>>)
+            {
+                using F = typename detail::realOf<promote_t<L, R>>::type;
+                return detail::toPolar<F>(a) / detail::toPolar<F>(b);
+            }
+            else
+                return as<promote_t<L, R>>(a) / as<promote_t<L, R>>(b);
+        }
+
+        /**
+         * @brief Less-than comparison by value (magnitude for complex and polar types).
+         *        BigInt against an integer compares exactly.
+         * @param a Left operand.
+         * @param b Right operand.
+         * @return true if a orders before b.
+         */
+        template <typename L, typename R>
+        constexpr bool less(const L &a, const R &b)
+        {
+            if constexpr (std::is_same_v<promote_t<L, R>, BigInt>)
+                return as<BigInt>(a) < as<BigInt>(b);
+            else
+                return valueOf(a) < valueOf(b);
+        }
+    }
+}
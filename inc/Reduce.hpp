@@ -0,0 +1,438 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "NumericVector.hpp"
+#include "Type.hpp"
+
+/**
+ * @file Reduce.hpp
+ * @brief Reductions over contiguous arrays: sum, dot product and min/max by magnitude.
+ *
+ * The loops keep several independent accumulators so the compiler can keep
+ * them in separate vector lanes; floating-point results may therefore differ
+ * from a left-to-right loop in the last bits. Use Summation::Kahan or
+ * Summation::Pairwise when that matters.
+ *
+ * Ordering follows Numeric::operator<: arithmetic values compare by value,
+ * complex values by magnitude. Magnitudes are compared squared, so no
+ * std::sqrt is evaluated.
+ */
+
+namespace myStd
+{
+    /**
+     * @brief Summation algorithm for floating-point sums.
+     */
+    enum class Summation
+    {
+        Fast,    ///< Multiple independent accumulators
+        Kahan,   ///< Compensated (Kahan-Babuska) summation, error independent of n
+        Pairwise ///< Recursive pairwise summation, error grows with log(n)
+    };
+
+    namespace reduce
+    {
+        /// Number of independent accumulators used by the fast loops.
+        constexpr std::size_t LANES = 8;
+
+        /// Block size below which pairwise summation switches to the fast loop.
+        constexpr std::size_t PAIRWISE_BLOCK = 256;
+
+        /**
+         * @brief Ordering key of a value: the value itself, the squared magnitude for
+         *        complex types, or the stored magnitude for polar types.
+         */
+        template <typename T>
+        auto key(const T &v)
+        {
+            if constexpr (is_complex<T>::value)
+            {
+                double re = static_cast<double>(v.getReal());
+                double im = static_cast<double>(v.getImg());
+                return re * re + im * im;
+            }
+            else if constexpr (is_polar_v<T>)
+                return static_cast<double>(v.magnitude());
+            else
+                return v;
+        }
+
+        template <typename T>
+        auto key(const Type<T> &v)
+        {
+            return key(v.get());
+        }
+
+        /**
+         * @brief Sum with LANES independent accumulators.
+         */
+        template <typename T>
+        T fastSum(const T *data, std::size_t n)
+        {
+            T acc[LANES] = {};
+            std::size_t i = 0;
+            for (; i + LANES <= n; i += LANES)
+                for (std::size_t j = 0; j < LANES; ++j)
+                    acc[j] += data[i + j];
+            T total{};
+            for (std::size_t j = 0; j < LANES; ++j)
+                total += acc[j];
+            for (; i < n; ++i)
+                total += data[i];
+            return total;
+        }
+
+        /**
+         * @brief Compensated sum with LANES independent (sum, compensation) pairs.
+         */
+        template <typename F>
+        F kahanSum(const F *data, std::size_t n)
+        {
+            F sum[LANES] = {}, comp[LANES] = {};
+            auto step = [](F &s, F &c, F x)
+            {
+                // Neumaier's variant: also correct when |x| > |s|
+                F t = s + x;
+                c += std::abs(s) >= std::abs(x) ? (s - t) + x : (x - t) + s;
+                s = t;
+            };
+            std::size_t i = 0;
+            for (; i + LANES <= n; i += LANES)
+                for (std::size_t j = 0; j < LANES; ++j)
+                    step(sum[j], comp[j], data[i + j]);
+            for (std::size_t j = 0; i < n; ++i, j = (j + 1) % LANES)
+                step(sum[j], comp[j], data[i]);
+            F s{}, c{};
+            for (std::size_t j = 0; j < LANES; ++j)
+            {
+                step(s, c, sum[j]);
+                c += comp[j];
+            }
+            return s + c;
+        }
+
+        /**
+         * @brief Pairwise sum: fast loop on blocks, halves combined recursively.
+         */
+        template <typename F>
+        F pairwiseSum(const F *data, std::size_t n)
+        {
+            if (n <= PAIRWISE_BLOCK)
+                return fastSum(data, n);
+            std::size_t half = n / 2;
+            return pairwiseSum(data, half) + pairwiseSum(data + half, n - half);
+        }
+    }
+
+    // =========================
+    // Sum
+    // =========================
+
+    /**
+     * @brief Sums an array of arithmetic values.
+     * @param data Pointer to the first element.
+     * @param n Number of elements.
+     * @param mode Summation algorithm, only used for floating-point T.
+     * @return Sum of the elements.
+     */
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    T sum(const T *data, std::size_t n, Summation mode = Summation::Fast)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            if (mode == Summation::Kahan)
+                return reduce::kahanSum(data, n);
+            if (mode == Summation::Pairwise)
+                return reduce::pairwiseSum(data, n);
+        }
+        return reduce::fastSum(data, n);
+    }
+
+    /**
+     * @brief Sums an array of complex values.
+     * @param data Pointer to the first element.
+     * @param n Number of elements.
+     * @return Sum of the elements.
+     */
+    template <typename T, typename U>
+    Complex<T, U> sum(const Complex<T, U> *data, std::size_t n)
+    {
+        T re[reduce::LANES] = {};
+        U im[reduce::LANES] = {};
+        std::size_t i = 0;
+        for (; i + reduce::LANES <= n; i += reduce::LANES)
+            for (std::size_t j = 0; j < reduce::LANES; ++j)
+            {
+                re[j] += data[i + j].getReal();
+                im[j] += data[i + j].getImg();
+            }
+        T totalRe{};
+        U totalIm{};
+        for (std::size_t j = 0; j < reduce::LANES; ++j)
+        {
+            totalRe += re[j];
+            totalIm += im[j];
+        }
+        for (; i < n; ++i)
+        {
+            totalRe += data[i].getReal();
+            totalIm += data[i].getImg();
+        }
+        return Complex<T, U>(totalRe, totalIm);
+    }
+
+    /**
+     * @brief Sums an array of Type<T> values.
+     * @param data Pointer to the first element.
+     * @param n Number of elements.
+     * @return Sum of the elements as T.
+     */
+    template <typename T>
+    T sum(const Type<T> *data, std::size_t n)
+    {
+        T acc[reduce::LANES] = {};
+        std::size_t i = 0;
+        for (; i + reduce::LANES <= n; i += reduce::LANES)
+            for (std::size_t j = 0; j < reduce::LANES; ++j)
+                acc[j] += data[i + j].get();
+        T total{};
+        for (std::size_t j = 0; j < reduce::LANES; ++j)
+            total += acc[j];
+        for (; i < n; ++i)
+            total += data[i].get();
+        return total;
+    }
+
+    /**
+     * @brief Sums a NumericVector.
+     */
+    template <typename T>
+    T sum(const NumericVector<T> &v, Summation mode = Summation::Fast)
+    {
+        return sum(v.raw(), v.size(), mode);
+    }
+
+    template <typename F>
+    Complex<F, F> sum(const NumericVector<Complex<F, F>> &v, Summation mode = Summation::Fast)
+    {
+        return Complex<F, F>(sum(v.realData(), v.size(), mode), sum(v.imagData(), v.size(), mode));
+    }
+
+    // =========================
+    // Dot Product
+    // =========================
+
+    /**
+     * @brief Dot product of two arithmetic arrays.
+     * @param a First array.
+     * @param b Second array.
+     * @param n Number of elements.
+     * @return Sum of a[i] * b[i].
+     */
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    T dot(const T *a, const T *b, std::size_t n)
+    {
+        T acc[reduce::LANES] = {};
+        std::size_t i = 0;
+        for (; i + reduce::LANES <= n; i += reduce::LANES)
+            for (std::size_t j = 0; j < reduce::LANES; ++j)
+                acc[j] += a[i + j] * b[i + j];
+        T total{};
+        for (std::size_t j = 0; j < reduce::LANES; ++j)
+            total += acc[j];
+        for (; i < n; ++i)
+            total += a[i] * b[i];
+        return total;
+    }
+
+    /**
+     * @brief Dot product of two NumericVectors.
+     * @throws std::runtime_error on size mismatch.
+     */
+    template <typename T>
+    T dot(const NumericVector<T> &a, const NumericVector<T> &b)
+    {
+        if (a.size() != b.size())
+            throw(std::runtime_error("Size mismatch!"));
+        return dot(a.raw(), b.raw(), a.size());
+    }
+
+    /**
+     * @brief Unconjugated dot product of two complex NumericVectors: sum of a[i] * b[i].
+     * @throws std::runtime_error on size mismatch.
+     */
+    template <typename F>
+    Complex<F, F> dot(const NumericVector<Complex<F, F>> &a, const NumericVector<Complex<F, F>> &b)
+    {
+        if (a.size() != b.size())
+            throw(std::runtime_error("Size mismatch!"));
+        const F *ar = a.realData(), *ai = a.imagData(), *br = b.realData(), *bi = b.imagData();
+        F re[reduce::LANES] = {}, im[reduce::LANES] = {};
+        std::size_t n = a.size(), i = 0;
+        for (; i + reduce::LANES <= n; i += reduce::LANES)
+            for (std::size_t j = 0; j < reduce::LANES; ++j)
+            {
+                re[j] += ar[i + j] * br[i + j] - ai[i + j] * bi[i + j];
+                im[j] += ar[i + j] * bi[i + j] + ai[i + j] * br[i + j];
+            }
+        F totalRe{}, totalIm{};
+        for (std::size_t j = 0; j < reduce::LANES; ++j)
+        {
+            totalRe += re[j];
+            totalIm += im[j];
+        }
+        for (; i < n; ++i)
+        {
+            totalRe += ar[i] * br[i] - ai[i] * bi[i];
+            totalIm += ar[i] * bi[i] + ai[i] * br[i];
+        }
+        return Complex<F, F>(totalRe, totalIm);
+    }
+
+    // =========================
+    // Min / Max
+    // =========================
+
+    namespace reduce
+    {
+        /**
+         * @brief Index of the first extreme key, where keyAt(i) gives the key of element i.
+         *
+         * The extreme key is found first with LANES branch-free running max/min
+         * (vectorizable), then its first index is located with a short scan.
+         *
+         * @tparam Greater true for the maximum, false for the minimum.
+         * @throws std::runtime_error if n == 0.
+         */
+        template <bool Greater, typename KeyAt>
+        std::size_t argExtreme(KeyAt keyAt, std::size_t n)
+        {
+            if (n == 0)
+                throw(std::runtime_error("Empty array!"));
+            using K = decltype(keyAt(std::size_t{0}));
+            K best[LANES];
+            for (std::size_t j = 0; j < LANES; ++j)
+                best[j] = keyAt(0);
+            std::size_t i = 0;
+            for (; i + LANES <= n; i += LANES)
+                for (std::size_t j = 0; j < LANES; ++j)
+                {
+                    K k = keyAt(i + j);
+                    best[j] = (Greater ? best[j] < k : k < best[j]) ? k : best[j];
+                }
+            for (; i < n; ++i)
+            {
+                K k = keyAt(i);
+                best[0] = (Greater ? best[0] < k : k < best[0]) ? k : best[0];
+            }
+            K extreme = best[0];
+            for (std::size_t j = 1; j < LANES; ++j)
+                extreme = (Greater ? extreme < best[j] : best[j] < extreme) ? best[j] : extreme;
+            for (i = 0; i < n; ++i)
+                if (keyAt(i) == extreme)
+                    return i;
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Index of the largest element (by magnitude for complex values).
+     * @param data Pointer to the first element (T, Complex<T, U> or Type<T>).
+     * @param n Number of elements.
+     * @return Index of the first maximal element.
+     * @throws std::runtime_error if n == 0.
+     */
+    template <typename T>
+    std::size_t argMax(const T *data, std::size_t n)
+    {
+        return reduce::argExtreme<true>([data](std::size_t i)
+                                        { return reduce::key(data[i]); },
+                                        n);
+    }
+
+    /**
+     * @brief Index of the smallest element (by magnitude for complex values).
+     * @param data Pointer to the first element (T, Complex<T, U> or Type<T>).
+     * @param n Number of elements.
+     * @return Index of the first minimal element.
+     * @throws std::runtime_error if n == 0.
+     */
+    template <typename T>
+    std::size_t argMin(const T *data, std::size_t n)
+    {
+        return reduce::argExtreme<false>([data](std::size_t i)
+                                         { return reduce::key(data[i]); },
+                                         n);
+    }
+
+    /**
+     * @brief Largest element of an array.
+     * @throws std::runtime_error if n == 0.
+     */
+    template <typename T>
+    const T &maxElement(const T *data, std::size_t n)
+    {
+        return data[argMax(data, n)];
+    }
+
+    /**
+     * @brief Smallest element of an array.
+     * @throws std::runtime_error if n == 0.
+     */
+    template <typename T>
+    const T &minElement(const T *data, std::size_t n)
+    {
+        return data[argMin(data, n)];
+    }
+
+    /**
+     * @brief Index of the largest element of a NumericVector.
+     * @throws std::runtime_error if v is empty.
+     */
+    template <typename T>
+    std::size_t argMax(const NumericVector<T> &v)
+    {
+        return argMax(v.raw(), v.size());
+    }
+
+    /**
+     * @brief Index of the smallest element of a NumericVector.
+     * @throws std::runtime_error if v is empty.
+     */
+    template <typename T>
+    std::size_t argMin(const NumericVector<T> &v)
+    {
+        return argMin(v.raw(), v.size());
+    }
+
+    /**
+     * @brief Index of the element with the largest magnitude in a complex NumericVector.
+     * @throws std::runtime_error if v is empty.
+     */
+    template <typename F>
+    std::size_t argMax(const NumericVector<Complex<F, F>> &v)
+    {
+        const F *re = v.realData(), *im = v.imagData();
+        return reduce::argExtreme<true>([re, im](std::size_t i)
+                                        { return re[i] * re[i] + im[i] * im[i]; },
+                                        v.size());
+    }
+
+    /**
+     * @brief Index of the element with the smallest magnitude in a complex NumericVector.
+     * @throws std::runtime_error if v is empty.
+     */
+    template <typename F>
+    std::size_t argMin(const NumericVector<Complex<F, F>> &v)
+    {
+        const F *re = v.realData(), *im = v.imagData();
+        return reduce::argExtreme<false>([re, im](std::size_t i)
+                                         { return re[i] * re[i] + im[i] * im[i]; },
+                                         v.size());
+    }
+}
@@ -0,0 +1,442 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Numeric.hpp"
+#include "Type.hpp"
+#include "TypeTag.hpp"
+
+/**
+ * @file Serialize.hpp
+ * @brief Binary storage of numeric arrays and a read-only memory-mapped view.
+ *
+ * A file is a 64-byte header followed by the payload:
+ *  - homogeneous arrays: the elements back to back in their in-memory layout,
+ *    sizeof(T) bytes each, so a mapped file is used in place as a const T*
+ *  - heterogeneous Numeric collections: per element, one tag byte and the
+ *    value of that tag's type; a BigInt, which is not trivially copyable, is
+ *    written as a 64-bit word (limb count << 1 | sign) and its limbs
+ *
+ * The header records the element tag, size and alignment, the element count
+ * and the byte order of the writer. Readers reject files whose header does not
+ * match, rather than reinterpret them.
+ */
+
+namespace myStd
+{
+    /// Tag stored in the header of a heterogeneous Numeric collection.
+    constexpr TypeTag mixedTag = 0xFE;
+
+    /**
+     * @brief Header at the start of every file.
+     */
+    struct FileHeader
+    {
+        char magic[8];              ///< "MYSTDNUM"
+        std::uint32_t version;      ///< Format version
+        std::uint32_t byteOrder;    ///< 0x01020304 as written by the producer
+        TypeTag tag;                ///< Element tag, or mixedTag
+        std::uint8_t elementSize;   ///< sizeof(T), 0 for mixed collections
+        std::uint8_t elementAlign;  ///< alignof(T), 0 for mixed collections
+        std::uint8_t reserved[5];   ///< Zero
+        std::uint64_t count;        ///< Number of elements
+        std::uint64_t payloadOffset; ///< Offset of the first element from the start of the file
+    };
+
+    namespace detail
+    {
+        constexpr char FILE_MAGIC[8] = {'M', 'Y', 'S', 'T', 'D', 'N', 'U', 'M'};
+        constexpr std::uint32_t FILE_VERSION = 1;
+        constexpr std::uint32_t ENDIAN_MARK = 0x01020304;
+
+        /// Payload starts on a cache line, so mapped elements are aligned.
+        constexpr std::uint64_t PAYLOAD_OFFSET = 64;
+        static_assert(sizeof(FileHeader) <= PAYLOAD_OFFSET, "FileHeader must fit in front of the payload");
+
+        inline FileHeader makeHeader(TypeTag tag, std::size_t size, std::size_t align, std::uint64_t count)
+        {
+            FileHeader h{};
+            std::memcpy(h.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+            h.version = FILE_VERSION;
+            h.byteOrder = ENDIAN_MARK;
+            h.tag = tag;
+            h.elementSize = static_cast<std::uint8_t>(size);
+            h.elementAlign = static_cast<std::uint8_t>(align);
+            h.count = count;
+            h.payloadOffset = PAYLOAD_OFFSET;
+            return h;
+        }
+
+        /// Throws if h is not a header of this format for the given tag and element size.
+        inline void checkHeader(const FileHeader &h, TypeTag tag, std::size_t size)
+        {
+            if (std::memcmp(h.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+                throw(std::runtime_error("Not a numeric array file"));
+            if (h.version != FILE_VERSION)
+                throw(std::runtime_error("Unsupported numeric array file version"));
+            if (h.byteOrder != ENDIAN_MARK)
+                throw(std::runtime_error("Numeric array file has a different byte order"));
+            if (h.tag != tag || h.elementSize != size)
+                throw(std::runtime_error("Numeric array file holds a different element type"));
+            if (h.payloadOffset < PAYLOAD_OFFSET)
+                throw(std::runtime_error("Corrupt numeric array file header"));
+        }
+
+        inline void writeHeader(std::ostream &os, const FileHeader &h)
+        {
+            char block[PAYLOAD_OFFSET] = {};
+            std::memcpy(block, &h, sizeof(h));
+            os.write(block, sizeof(block));
+        }
+
+        inline FileHeader readHeader(std::istream &is)
+        {
+            char block[PAYLOAD_OFFSET];
+            if (!is.read(block, sizeof(block)))
+                throw(std::runtime_error("Truncated numeric array file"));
+            FileHeader h;
+            std::memcpy(&h, block, sizeof(h));
+            return h;
+        }
+
+        /// Skips from the end of the header block to the payload of a header that passed checkHeader.
+        inline void skipToPayload(std::istream &is, const FileHeader &h)
+        {
+            std::uint64_t gap = h.payloadOffset - PAYLOAD_OFFSET;
+            if (gap > static_cast<std::uint64_t>(std::numeric_limits<std::streamsize>::max()))
+                throw(std::runtime_error("Corrupt numeric array file header"));
+            if (gap && !is.ignore(static_cast<std::streamsize>(gap)))
+                throw(std::runtime_error("Truncated numeric array file"));
+        }
+
+        template <typename T>
+        constexpr void checkSerializable()
+        {
+            static_assert(typeTag<T> != noTag, "Only types listed in NumericTypes can be serialized");
+            static_assert(std::is_trivially_copyable_v<T>, "Serialized types must be trivially copyable");
+        }
+
+        /// Elements read per step, so a corrupt count fails at the end of the stream instead of allocating it.
+        constexpr std::size_t READ_BLOCK = 4096;
+
+        /// Writes the value of a Numeric known to be a Type<T>.
+        template <typename T>
+        void writeValue(std::ostream &os, const Numeric &num)
+        {
+            const T &v = static_cast<const Type<T> &>(num).get();
+            if constexpr (std::is_same_v<T, BigInt>)
+            {
+                std::uint64_t word = (static_cast<std::uint64_t>(v.limbCount()) << 1) | v.isNegative();
+                os.write(reinterpret_cast<const char *>(&word), sizeof(word));
+                os.write(reinterpret_cast<const char *>(v.data()), static_cast<std::streamsize>(v.limbCount() * sizeof(BigInt::Limb)));
+            }
+            else
+                os.write(reinterpret_cast<const char *>(&v), sizeof(T));
+        }
+
+        /// Writes the value of num, whose tag selects its type among Ts.
+        template <typename... Ts>
+        void writeTagged(std::ostream &os, const Numeric &num, TypeList<Ts...>)
+        {
+            TypeTag tag = num.getTag(), i = 0;
+            bool known = ((i++ == tag ? (writeValue<Ts>(os, num), true) : false) || ...);
+            if (!known)
+                throw(std::runtime_error("Only types listed in NumericTypes can be serialized"));
+        }
+
+        /// Reads one T and returns it as a new Type<T>, nullptr if the stream ran out.
+        template <typename T>
+        std::unique_ptr<Numeric> readValue(std::istream &is)
+        {
+            if constexpr (std::is_same_v<T, BigInt>)
+            {
+                std::uint64_t word;
+                if (!is.read(reinterpret_cast<char *>(&word), sizeof(word)))
+                    return nullptr;
+                std::vector<BigInt::Limb> limbs;
+                for (std::uint64_t left = word >> 1; left > 0;)
+                {
+                    std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(left, READ_BLOCK)), at = limbs.size();
+                    limbs.resize(at + n);
+                    if (!is.read(reinterpret_cast<char *>(limbs.data() + at), static_cast<std::streamsize>(n * sizeof(BigInt::Limb))))
+                        return nullptr;
+                    left -= n;
+                }
+                return std::make_unique<Type<BigInt>>(BigInt::fromLimbs(limbs.data(), limbs.size(), word & 1));
+            }
+            else
+            {
+                T value;
+                if (!is.read(reinterpret_cast<char *>(&value), sizeof(T)))
+                    return nullptr;
+                return std::make_unique<Type<T>>(value);
+            }
+        }
+
+        /// Reads one value of the type with this tag among Ts.
+        template <typename... Ts>
+        std::unique_ptr<Numeric> readTagged(std::istream &is, TypeTag tag, TypeList<Ts...>)
+        {
+            std::unique_ptr<Numeric> out;
+            TypeTag i = 0;
+            bool known = ((i++ == tag ? (out = readValue<Ts>(is), true) : false) || ...);
+            if (!known)
+                throw(std::runtime_error("Unknown type tag in numeric array file"));
+            if (!out)
+                throw(std::runtime_error("Truncated numeric array file"));
+            return out;
+        }
+    }
+
+    // =========================
+    // Homogeneous Arrays
+    // =========================
+
+    /**
+     * @brief Writes n values of T as one array.
+     * @param os Binary output stream.
+     * @param data First element.
+     * @param n Number of elements.
+     * @throws std::runtime_error if the stream fails.
+     */
+    template <typename T>
+    void writeArray(std::ostream &os, const T *data, std::size_t n)
+    {
+        detail::checkSerializable<T>();
+        detail::writeHeader(os, detail::makeHeader(typeTag<T>, sizeof(T), alignof(T), n));
+        os.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(n * sizeof(T)));
+        if (!os)
+            throw(std::runtime_error("Failed to write numeric array"));
+    }
+
+    template <typename T>
+    void writeArray(std::ostream &os, const std::vector<T> &v)
+    {
+        writeArray(os, v.data(), v.size());
+    }
+
+    /**
+     * @brief Writes the values of a vector of Type<T> as an array of T.
+     */
+    template <typename T>
+    void writeArray(std::ostream &os, const std::vector<Type<T>> &v)
+    {
+        detail::checkSerializable<T>();
+        detail::writeHeader(os, detail::makeHeader(typeTag<T>, sizeof(T), alignof(T), v.size()));
+        // Type<T> carries a vtable pointer and tag; stage the bare values in blocks
+        constexpr std::size_t BLOCK = 4096;
+        std::vector<T> block;
+        block.reserve(BLOCK);
+        for (std::size_t i = 0; i < v.size(); i += BLOCK)
+        {
+            block.clear();
+            for (std::size_t j = i; j < v.size() && j < i + BLOCK; ++j)
+                block.push_back(v[j].get());
+            os.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size() * sizeof(T)));
+        }
+        if (!os)
+            throw(std::runtime_error("Failed to write numeric array"));
+    }
+
+    /**
+     * @brief Reads an array written by writeArray.
+     * @param is Binary input stream.
+     * @return The elements.
+     * @throws std::runtime_error if the file is malformed, truncated or holds another type.
+     */
+    template <typename T>
+    std::vector<T> readArray(std::istream &is)
+    {
+        detail::checkSerializable<T>();
+        FileHeader h = detail::readHeader(is);
+        detail::checkHeader(h, typeTag<T>, sizeof(T));
+        detail::skipToPayload(is, h);
+        std::vector<T> v;
+        for (std::uint64_t left = h.count; left > 0;)
+        {
+            std::size_t k = static_cast<std::size_t>(std::min<std::uint64_t>(left, detail::READ_BLOCK)), at = v.size();
+            v.resize(at + k);
+            if (!is.read(reinterpret_cast<char *>(v.data() + at), static_cast<std::streamsize>(k * sizeof(T))))
+                throw(std::runtime_error("Truncated numeric array file"));
+            left -= k;
+        }
+        return v;
+    }
+
+    // =========================
+    // Heterogeneous Collections
+    // =========================
+
+    /**
+     * @brief Writes a collection of Numerics of any listed types, one tag byte per element.
+     * @throws std::runtime_error for a type not listed in NumericTypes or if the stream fails.
+     */
+    inline void writeNumerics(std::ostream &os, const std::vector<std::unique_ptr<Numeric>> &v)
+    {
+        detail::writeHeader(os, detail::makeHeader(mixedTag, 0, 0, v.size()));
+        for (const auto &p : v)
+        {
+            TypeTag tag = p->getTag();
+            os.put(static_cast<char>(tag));
+            detail::writeTagged(os, *p, NumericTypes{});
+        }
+        if (!os)
+            throw(std::runtime_error("Failed to write numeric array"));
+    }
+
+    /**
+     * @brief Reads a collection written by writeNumerics.
+     * @throws std::runtime_error if the file is malformed or truncated.
+     */
+    inline std::vector<std::unique_ptr<Numeric>> readNumerics(std::istream &is)
+    {
+        FileHeader h = detail::readHeader(is);
+        detail::checkHeader(h, mixedTag, 0);
+        detail::skipToPayload(is, h);
+        std::vector<std::unique_ptr<Numeric>> v;
+        v.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(h.count, detail::READ_BLOCK)));
+        for (std::uint64_t i = 0; i < h.count; ++i)
+        {
+            int tag = is.get();
+            if (tag == std::char_traits<char>::eof())
+                throw(std::runtime_error("Truncated numeric array file"));
+            v.push_back(detail::readTagged(is, static_cast<TypeTag>(tag), NumericTypes{}));
+        }
+        return v;
+    }
+
+    // =========================
+    // Memory-Mapped View
+    // =========================
+
+    /**
+     * @brief Read-only view of an array file mapped into memory.
+     *
+     * The elements are used in place: opening validates the header and costs the
+     * same for any file size, and pages are read from disk as they are touched.
+     *
+     * @tparam T Element type the file must hold.
+     */
+    template <typename T>
+    class MappedArray
+    {
+    private:
+        void *base = nullptr;
+        std::size_t bytes = 0;
+        const T *first = nullptr;
+        std::size_t n = 0;
+
+        void unmap() noexcept
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            if (base)
+                munmap(base, bytes);
+#endif
+            base = nullptr;
+        }
+
+    public:
+        /**
+         * @brief Maps a file written by writeArray<T>.
+         * @param path File path.
+         * @throws std::runtime_error if the file can't be mapped or does not hold T.
+         */
+        explicit MappedArray(const std::string &path)
+        {
+            detail::checkSerializable<T>();
+#if defined(__unix__) || defined(__APPLE__)
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw(std::runtime_error("Can't open " + path));
+            struct stat st;
+            if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < detail::PAYLOAD_OFFSET)
+            {
+                ::close(fd);
+                throw(std::runtime_error("Truncated numeric array file"));
+            }
+            bytes = static_cast<std::size_t>(st.st_size);
+            base = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (base == MAP_FAILED)
+            {
+                base = nullptr;
+                throw(std::runtime_error("Can't map " + path));
+            }
+
+            FileHeader h;
+            std::memcpy(&h, base, sizeof(h));
+            try
+            {
+                detail::checkHeader(h, typeTag<T>, sizeof(T));
+                if (h.payloadOffset > bytes || h.payloadOffset % alignof(T) != 0)
+                    throw(std::runtime_error("Corrupt numeric array file header"));
+                // count * sizeof(T) <= bytes left, without the multiply that could wrap
+                if (h.count > (bytes - h.payloadOffset) / sizeof(T))
+                    throw(std::runtime_error("Truncated numeric array file"));
+            }
+            catch (...)
+            {
+                unmap();
+                throw;
+            }
+            first = reinterpret_cast<const T *>(static_cast<const char *>(base) + h.payloadOffset);
+            n = static_cast<std::size_t>(h.count);
+#else
+            (void)path;
+            throw(std::runtime_error("Memory-mapped files are not supported on this platform"));
+#endif
+        }
+
+        ~MappedArray() { unmap(); }
+
+        MappedArray(const MappedArray &) = delete;
+        MappedArray &operator=(const MappedArray &) = delete;
+
+        MappedArray(MappedArray &&obj) noexcept
+            : base(obj.base), bytes(obj.bytes), first(obj.first), n(obj.n)
+        {
+            obj.base = nullptr;
+            obj.first = nullptr;
+            obj.n = 0;
+        }
+
+        MappedArray &operator=(MappedArray &&obj) noexcept
+        {
+            if (this != &obj)
+            {
+                unmap();
+                base = obj.base;
+                bytes = obj.bytes;
+                first = obj.first;
+                n = obj.n;
+                obj.base = nullptr;
+                obj.first = nullptr;
+                obj.n = 0;
+            }
+            return *this;
+        }
+
+        std::size_t size() const { return n; }
+        const T *data() const { return first; }
+        const T &operator[](std::size_t i) const { return first[i]; }
+        const T *begin() const { return first; }
+        const T *end() const { return first + n; }
+    };
+}
@@ -0,0 +1,242 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @file Simd.hpp
+ * @brief Element-wise kernels over contiguous arrays.
+ *
+ * The loops are written so that the compiler can vectorize them (no branches,
+ * unit stride). Output arrays may alias an input array element-for-element, so
+ * the kernels can be used in place. Kernels that the compiler cannot vectorize on its
+ * own, such as std::sqrt which may set errno, use SSE2/AVX intrinsics when
+ * available and fall back to scalar code otherwise.
+ */
+
+namespace myStd
+{
+    namespace simd
+    {
+        // =========================
+        // Real Kernels
+        // =========================
+
+        /// out[i] = a[i] + b[i]
+        template <typename T>
+        void add(const T *a, const T *b, T *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] + b[i];
+        }
+
+        /// out[i] = a[i] - b[i]
+        template <typename T>
+        void sub(const T *a, const T *b, T *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] - b[i];
+        }
+
+        /// out[i] = a[i] * b[i]
+        template <typename T>
+        void mul(const T *a, const T *b, T *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] * b[i];
+        }
+
+        /// out[i] = a[i] / b[i]
+        template <typename T>
+        void div(const T *a, const T *b, T *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] / b[i];
+        }
+
+        /// out[i] = a[i] + s
+        template <typename T>
+        void addScalar(const T *a, T s, T *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] + s;
+        }
+
+        /// out[i] = a[i] - s
+        template <typename T>
+        void subScalar(const T *a, T s, T *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] - s;
+        }
+
+        /// out[i] = a[i] * s
+        template <typename T>
+        void mulScalar(const T *a, T s, T *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] * s;
+        }
+
+        /// out[i] = a[i] / s
+        template <typename T>
+        void divScalar(const T *a, T s, T *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = a[i] / s;
+        }
+
+        /// out[i] = static_cast<double>(a[i])
+        template <typename T>
+        void toDouble(const T *a, double *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = static_cast<double>(a[i]);
+        }
+
+        /// out[i] = static_cast<D>(a[i]), e.g. float <-> Q15 with rounding and saturation
+        template <typename S, typename D>
+        void convert(const S *a, D *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = static_cast<D>(a[i]);
+        }
+
+        // =========================
+        // Complex Kernels (split real/imaginary arrays)
+        // =========================
+
+        /// (outRe + i outIm)[k] = (aRe + i aIm)[k] * (bRe + i bIm)[k]
+        template <typename F>
+        void complexMul(const F *aRe, const F *aIm,
+                        const F *bRe, const F *bIm,
+                        F *outRe, F *outIm, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                F re = aRe[i] * bRe[i] - aIm[i] * bIm[i];
+                F im = aRe[i] * bIm[i] + aIm[i] * bRe[i];
+                outRe[i] = re;
+                outIm[i] = im;
+            }
+        }
+
+        /// (outRe + i outIm)[k] = (aRe + i aIm)[k] / (bRe + i bIm)[k]
+        template <typename F>
+        void complexDiv(const F *aRe, const F *aIm,
+                        const F *bRe, const F *bIm,
+                        F *outRe, F *outIm, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                F inv = F(1) / (bRe[i] * bRe[i] + bIm[i] * bIm[i]);
+                F re = (aRe[i] * bRe[i] + aIm[i] * bIm[i]) * inv;
+                F im = (aIm[i] * bRe[i] - aRe[i] * bIm[i]) * inv;
+                outRe[i] = re;
+                outIm[i] = im;
+            }
+        }
+
+        /// Same as complexDiv, using Smith's algorithm: no overflow or underflow in |b|^2.
+        template <typename F>
+        void complexDivSmith(const F *aRe, const F *aIm, const F *bRe, const F *bIm,
+                             F *outRe, F *outIm, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // Scale by the larger of |c| and |d|; selects instead of branches keep the loop vectorizable
+                F c = bRe[i], d = bIm[i];
+                bool big = std::abs(c) >= std::abs(d);
+                F p = big ? c : d, q = big ? d : c;
+                F x = big ? aRe[i] : aIm[i], y = big ? aIm[i] : aRe[i];
+                F r = q / p;
+                F inv = F(1) / (p + q * r);
+                F re = (x + y * r) * inv;
+                F im = (y - x * r) * inv;
+                outRe[i] = re;
+                outIm[i] = big ? im : -im;
+            }
+        }
+
+        /// (outRe + i outIm)[k] = (aRe + i aIm)[k] * (sRe + i sIm)
+        template <typename F>
+        void complexMulScalar(const F *aRe, const F *aIm, F sRe, F sIm,
+                              F *outRe, F *outIm, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                F re = aRe[i] * sRe - aIm[i] * sIm;
+                F im = aRe[i] * sIm + aIm[i] * sRe;
+                outRe[i] = re;
+                outIm[i] = im;
+            }
+        }
+
+        /// out[k] = |(re + i im)[k]|, scalar fallback.
+        template <typename F>
+        void magnitude(const F *re, const F *im, F *out, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                out[i] = std::sqrt(re[i] * re[i] + im[i] * im[i]);
+        }
+
+        /// out[k] = |(re + i im)[k]| for double, using SSE2/AVX square roots.
+        template <>
+        inline void magnitude<double>(const double *re, const double *im,
+                                      double *out, std::size_t n)
+        {
+            std::size_t i = 0;
+#if defined(__AVX__)
+            for (; i + 4 <= n; i += 4)
+            {
+                __m256d r = _mm256_loadu_pd(re + i);
+                __m256d m = _mm256_loadu_pd(im + i);
+                __m256d sq = _mm256_add_pd(_mm256_mul_pd(r, r), _mm256_mul_pd(m, m));
+                _mm256_storeu_pd(out + i, _mm256_sqrt_pd(sq));
+            }
+#elif defined(__SSE2__) || defined(_M_X64)
+            for (; i + 2 <= n; i += 2)
+            {
+                __m128d r = _mm_loadu_pd(re + i);
+                __m128d m = _mm_loadu_pd(im + i);
+                __m128d sq = _mm_add_pd(_mm_mul_pd(r, r), _mm_mul_pd(m, m));
+                _mm_storeu_pd(out + i, _mm_sqrt_pd(sq));
+            }
+#endif
+            for (; i < n; ++i)
+                out[i] = std::sqrt(re[i] * re[i] + im[i] * im[i]);
+        }
+
+        /// out[k] = |(re + i im)[k]| for float, twice as many lanes per register as double.
+        template <>
+        inline void magnitude<float>(const float *re, const float *im,
+                                     float *out, std::size_t n)
+        {
+            std::size_t i = 0;
+#if defined(__AVX__)
+            for (; i + 8 <= n; i += 8)
+            {
+                __m256 r = _mm256_loadu_ps(re + i);
+                __m256 m = _mm256_loadu_ps(im + i);
+                __m256 sq = _mm256_add_ps(_mm256_mul_ps(r, r), _mm256_mul_ps(m, m));
+                _mm256_storeu_ps(out + i, _mm256_sqrt_ps(sq));
+            }
+#elif defined(__SSE2__) || defined(_M_X64)
+            for (; i + 4 <= n; i += 4)
+            {
+                __m128 r = _mm_loadu_ps(re + i);
+                __m128 m = _mm_loadu_ps(im + i);
+                __m128 sq = _mm_add_ps(_mm_mul_ps(r, r), _mm_mul_ps(m, m));
+                _mm_storeu_ps(out + i, _mm_sqrt_ps(sq));
+            }
+#endif
+            for (; i < n; ++i)
+                out[i] = std::sqrt(re[i] * re[i] + im[i] * im[i]);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Numeric.hpp"
+#include "TypeTag.hpp"
+
+/**
+ * @file Sort.hpp
+ * @brief Sorting of heterogeneous Numeric collections by precomputed keys.
+ */
+
+namespace myStd
+{
+    namespace detail
+    {
+        /// Below this many elements sorting stays on the calling thread.
+        constexpr std::size_t PARALLEL_SORT_THRESHOLD = 1 << 15;
+
+        /// (getValue(), original index) pair; the index makes the order deterministic.
+        using SortKey = std::pair<double, std::size_t>;
+
+        /**
+         * @brief Runs fn(begin, end) on [0, n) split into `parts` contiguous ranges, one thread per range.
+         */
+        template <typename F>
+        void forEachRange(std::size_t n, unsigned parts, F fn)
+        {
+            std::vector<std::thread> workers;
+            std::size_t step = (n + parts - 1) / parts;
+            for (std::size_t begin = step; begin < n; begin += step)
+                workers.emplace_back(fn, begin, std::min(begin + step, n));
+            fn(std::size_t{0}, std::min(step, n));
+            for (auto &w : workers)
+                w.join();
+        }
+
+        /**
+         * @brief Sorts keys with `parts` threads: each range is sorted independently,
+         *        then neighbouring runs are merged pairwise, in parallel, until one run remains.
+         */
+        inline void parallelSort(std::vector<SortKey> &keys, unsigned parts)
+        {
+            std::size_t n = keys.size();
+            std::size_t step = (n + parts - 1) / parts;
+            forEachRange(n, parts, [&keys](std::size_t begin, std::size_t end)
+                         { std::sort(keys.begin() + begin, keys.begin() + end); });
+
+            std::vector<SortKey> buffer(n);
+            for (std::size_t width = step; width < n; width *= 2)
+            {
+                std::vector<std::thread> workers;
+                for (std::size_t begin = 0; begin < n; begin += 2 * width)
+                {
+                    std::size_t mid = std::min(begin + width, n);
+                    std::size_t end = std::min(begin + 2 * width, n);
+                    workers.emplace_back([&keys, &buffer, begin, mid, end]
+                                         { std::merge(keys.begin() + begin, keys.begin() + mid,
+                                                      keys.begin() + mid, keys.begin() + end,
+                                                      buffer.begin() + begin); });
+                }
+                for (auto &w : workers)
+                    w.join();
+                keys.swap(buffer);
+            }
+        }
+    }
+
+    /**
+     * @brief Sorts pointers to Numeric objects in ascending order.
+     *
+     * Keys are getValue() doubles, computed once per element instead of twice
+     * per comparison; they order elements as `*a < *b` does for every type a
+     * double holds exactly. The (key, index) pairs are sorted on up to `threads`
+     * threads, then the pointers are permuted once. Elements with equal keys
+     * keep their relative order.
+     *
+     * getValue() rounds a BigInt past 2^53, so two BigInts that differ beyond
+     * that would tie. A collection holding any BigInt is therefore sorted with
+     * std::stable_sort on `*a < *b` instead, on the calling thread.
+     *
+     * @tparam Ptr Pointer-like type to a Numeric (std::unique_ptr<Numeric>, Numeric *, ...).
+     * @param v Collection to sort.
+     * @param threads Number of threads, 0 for std::thread::hardware_concurrency().
+     */
+    template <typename Ptr>
+    void sortByValue(std::vector<Ptr> &v, unsigned threads = 0)
+    {
+        std::size_t n = v.size();
+        if (std::any_of(v.begin(), v.end(), [](const Ptr &p)
+                        { return p->getTag() == typeTag<BigInt>; }))
+        {
+            std::stable_sort(v.begin(), v.end(), [](const Ptr &a, const Ptr &b)
+                             { return *a < *b; });
+            return;
+        }
+
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        if (n < detail::PARALLEL_SORT_THRESHOLD)
+            threads = 1;
+
+        std::vector<detail::SortKey> keys(n);
+        detail::forEachRange(n, threads, [&v, &keys](std::size_t begin, std::size_t end)
+                             {
+            for (std::size_t i = begin; i < end; ++i)
+                keys[i] = {v[i]->getValue(), i}; });
+
+        if (threads == 1)
+            std::sort(keys.begin(), keys.end());
+        else
+            detail::parallelSort(keys, threads);
+
+        std::vector<Ptr> sorted;
+        sorted.reserve(n);
+        for (const auto &k : keys)
+            sorted.push_back(std::move(v[k.second]));
+        v = std::move(sorted);
+    }
+}
@@ -0,0 +1,234 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file ThreadPool.hpp
+ * @brief Work-stealing thread pool behind the parallel batch algorithms.
+ *
+ * Each worker owns a task deque: it takes its own work from the back and, when
+ * that runs dry, steals from the front of the others. A thread that waits for
+ * a parallelFor runs queued tasks itself instead of blocking, so parallel calls
+ * may be nested inside tasks without deadlock.
+ *
+ * A pool of `threads` uses threads - 1 workers plus the calling thread, so
+ * ThreadPool(1) runs everything inline.
+ */
+
+namespace myStd
+{
+    /**
+     * @brief Fixed-size work-stealing thread pool.
+     */
+    class ThreadPool
+    {
+    private:
+        using Task = std::function<void()>;
+
+        struct Queue
+        {
+            std::mutex m;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+        std::atomic<std::size_t> queued{0};
+        std::mutex sleepMutex;
+        std::condition_variable wake;
+        bool stopping = false;
+
+        /// Pool and queue index of the calling thread, if it is a worker.
+        inline static thread_local ThreadPool *currentPool = nullptr;
+        inline static thread_local std::size_t currentIndex = 0;
+
+        void push(std::size_t q, Task task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(queues[q]->m);
+                queues[q]->tasks.push_back(std::move(task));
+            }
+            queued.fetch_add(1, std::memory_order_release);
+            {
+                // Pairs with the predicate check in workerLoop, so no wake-up is lost
+                std::lock_guard<std::mutex> lock(sleepMutex);
+            }
+            wake.notify_one();
+        }
+
+        /// Takes a task from queue `own` (newest first), else steals the oldest from another queue.
+        bool take(std::size_t own, Task &task)
+        {
+            std::size_t n = queues.size();
+            if (own < n)
+            {
+                std::lock_guard<std::mutex> lock(queues[own]->m);
+                if (!queues[own]->tasks.empty())
+                {
+                    task = std::move(queues[own]->tasks.back());
+                    queues[own]->tasks.pop_back();
+                    queued.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            for (std::size_t k = 1; k <= n; ++k)
+            {
+                std::size_t victim = (own + k) % n;
+                std::lock_guard<std::mutex> lock(queues[victim]->m);
+                if (!queues[victim]->tasks.empty())
+                {
+                    task = std::move(queues[victim]->tasks.front());
+                    queues[victim]->tasks.pop_front();
+                    queued.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// Runs one queued task on the calling thread; false if there was none.
+        bool runOne()
+        {
+            if (queued.load(std::memory_order_acquire) == 0)
+                return false;
+            std::size_t own = currentPool == this ? currentIndex : queues.size();
+            Task task;
+            if (!take(own, task))
+                return false;
+            task();
+            return true;
+        }
+
+        void workerLoop(std::size_t index)
+        {
+            currentPool = this;
+            currentIndex = index;
+            for (;;)
+            {
+                if (runOne())
+                    continue;
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wake.wait(lock, [this]
+                          { return stopping || queued.load(std::memory_order_acquire) > 0; });
+                if (stopping && queued.load(std::memory_order_acquire) == 0)
+                    return;
+            }
+        }
+
+    public:
+        /**
+         * @brief Starts the workers.
+         * @param threads Threads taking part in parallel work, including the caller;
+         *        0 for std::thread::hardware_concurrency().
+         */
+        explicit ThreadPool(unsigned threads = 0)
+        {
+            if (threads == 0)
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            for (unsigned i = 0; i + 1 < threads; ++i)
+                queues.push_back(std::make_unique<Queue>());
+            for (std::size_t i = 0; i < queues.size(); ++i)
+                workers.emplace_back([this, i]
+                                     { workerLoop(i); });
+        }
+
+        /**
+         * @brief Finishes the queued tasks and joins the workers.
+         */
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto &w : workers)
+                w.join();
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /// Threads taking part in parallel work, including the caller.
+        unsigned size() const { return static_cast<unsigned>(workers.size() + 1); }
+
+        /**
+         * @brief Index of the calling thread in this pool: 0..size()-2 for workers,
+         *        size()-1 for any other thread.
+         */
+        std::size_t threadIndex() const
+        {
+            return currentPool == this ? currentIndex : workers.size();
+        }
+
+        /**
+         * @brief Shared pool with one thread per hardware thread.
+         */
+        static ThreadPool &global()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /**
+         * @brief Calls f(begin, end) over [0, n) in blocks of `grain` and returns when all are done.
+         *
+         * Blocks are dealt to the workers in contiguous runs, so neighbouring blocks
+         * tend to run on the same core; idle workers steal from the far end. The
+         * caller works too. The first exception thrown by f is rethrown here after
+         * the remaining blocks have finished.
+         *
+         * @param n Number of elements.
+         * @param grain Elements per block; 0 is treated as 1.
+         * @param f Callable (std::size_t begin, std::size_t end).
+         */
+        template <typename F>
+        void parallelFor(std::size_t n, std::size_t grain, F &&f)
+        {
+            grain = std::max<std::size_t>(grain, 1);
+            std::size_t blocks = (n + grain - 1) / grain;
+            if (blocks <= 1 || workers.empty())
+            {
+                for (std::size_t b = 0; b < n; b += grain)
+                    f(b, std::min(n, b + grain));
+                return;
+            }
+
+            std::atomic<std::size_t> pending{blocks};
+            std::mutex errorMutex;
+            std::exception_ptr error;
+            std::size_t q = queues.size();
+            for (std::size_t i = 0; i < blocks; ++i)
+            {
+                std::size_t begin = i * grain, end = std::min(n, begin + grain);
+                push(i * q / blocks, [&, begin, end]
+                     {
+                    try
+                    {
+                        f(begin, end);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (!error)
+                            error = std::current_exception();
+                    }
+                    pending.fetch_sub(1, std::memory_order_acq_rel); });
+            }
+            while (pending.load(std::memory_order_acquire) > 0)
+                if (!runOne())
+                    std::this_thread::yield();
+            if (error)
+                std::rethrow_exception(error);
+        }
+    };
+}
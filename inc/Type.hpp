@@ -5,20 +5,33 @@
 #include "Utils.hpp"
 #include "Numeric.hpp"
 #include "Complex.hpp"
+#include "Dispatch.hpp"
+#include "Instrument.hpp"
+#include "TypeTag.hpp"
 
 namespace myStd
 {
     /**
      * @brief Generic numeric wrapper class supporting arithmetic and polymorphic operations.
      *
+     * Thread safety: Type<T> is a plain value, like int. Any number of threads
+     * may call const members and the binary operators (+, -, *, /, <, >, ==) on
+     * the same objects at once, since those only read their operands. The compound
+     * operators (+=, -=, *=, /=), operator>> and assignment write the value without
+     * synchronization, so a Type<T> being modified must not be accessed by any other
+     * thread. For an accumulator shared between threads use AtomicType<T> or
+     * StripedAccumulator<T> from Atomic.hpp instead of a mutex around Type<T>.
+     * Results allocated by the binary operators come from the calling thread's
+     * ArenaScope, if any (see Arena.hpp).
+     *
      * @tparam T Underlying numeric or complex type.
      */
     template <typename T>
     class Type : public Numeric
     {
     private:
-        // Smart pointer to the underlying value of type T
-        std::unique_ptr<T> ptr;
+        // Underlying value of type T, stored inline (no heap allocation per value)
+        T val{};
 
         // Allow all instantiations of Type to access private members of each other
         template <typename>
@@ -35,45 +48,73 @@ namespace myStd
         {
             if (auto *ci = dynamic_cast<Type<Complex<int, int>> *>(&obj))
             {
-                c = Complex<double, double>(static_cast<double>(ci->ptr->real), static_cast<double>(ci->ptr->img));
+                c = Complex<double, double>(static_cast<double>(ci->val.real), static_cast<double>(ci->val.img));
                 return true;
             }
             if (auto *cd = dynamic_cast<Type<Complex<double, double>> *>(&obj))
             {
-                c = Complex<double, double>(cd->ptr->real, cd->ptr->img);
+                c = Complex<double, double>(cd->val.real, cd->val.img);
                 return true;
             }
             if (auto *cid = dynamic_cast<Type<Complex<int, double>> *>(&obj))
             {
-                c = Complex<double, double>(static_cast<double>(cid->ptr->real), cid->ptr->img);
+                c = Complex<double, double>(static_cast<double>(cid->val.real), cid->val.img);
                 return true;
             }
             if (auto *cdi = dynamic_cast<Type<Complex<double, int>> *>(&obj))
             {
-                c = Complex<double, double>(cdi->ptr->real, static_cast<double>(cdi->ptr->img));
+                c = Complex<double, double>(cdi->val.real, static_cast<double>(cdi->val.img));
+                return true;
+            }
+            if (auto *cf = dynamic_cast<Type<Complex<float, float>> *>(&obj))
+            {
+                c = Complex<double, double>(cf->val.real, cf->val.img);
                 return true;
             }
+            instrument::count(instrument::Event::CastFailure);
             return false;
         }
 
+        /**
+         * @brief Returns obj as Type<T> if it has the same type, nullptr otherwise.
+         *        Compares tags when T has one, falls back to dynamic_cast otherwise.
+         * @param obj Reference to a Numeric object.
+         * @return Pointer to obj as Type<T>, or nullptr.
+         */
+        Type<T> *sameType(Numeric &obj)
+        {
+            if constexpr (typeTag<T> != noTag)
+                return obj.getTag() == typeTag<T> ? static_cast<Type<T> *>(&obj) : nullptr;
+            else
+                return dynamic_cast<Type<T> *>(&obj);
+        }
+
+        /**
+         * @brief obj.getValue(), counted as a complex-to-double fallback when obj is complex.
+         * @param obj Reference to a Numeric object.
+         * @return Value of obj as double.
+         */
+        static double fallbackValue(Numeric &obj)
+        {
+            instrument::countComplexFallback(obj.getTag());
+            return obj.getValue();
+        }
+
     public:
         // =========================
         // Constructors & Destructor
         // =========================
 
         /**
-         * @brief Default constructor.
+         * @brief Default constructor. The stored value is value-initialized.
          */
-        Type() = default;
+        Type() : Numeric(typeTag<T>) {}
 
         /**
          * @brief Construct from a value of type T.
          * @param val Initial value.
          */
-        explicit Type(T val)
-        {
-            ptr = std::make_unique<T>(val);
-        }
+        explicit Type(T val) : Numeric(typeTag<T>), val(val) {}
 
         /**
          * @brief Destructor.
@@ -84,21 +125,18 @@ namespace myStd
          * @brief Copy constructor.
          * @param obj Object to copy from.
          */
-        Type(const Type<T> &obj)
-        {
-            ptr = std::make_unique<T>(*(obj.ptr));
-        }
+        Type(const Type<T> &obj) : Numeric(typeTag<T>), val(obj.val) {}
 
         /**
          * @brief Copy constructor.
          * @param uptr Unique pointer to a Numeric object.
          * @throws std::runtime_error if assignment is invalid.
          */
-        Type(std::unique_ptr<Numeric> uptr)
+        Type(std::unique_ptr<Numeric> uptr) : Numeric(typeTag<T>)
         {
             if (auto *castedPtr = dynamic_cast<Type<T> *>(uptr.get()))
             {
-                ptr = std::make_unique<T>(*(castedPtr->ptr));
+                val = std::move(castedPtr->val);
             }
             else
             {
@@ -107,13 +145,10 @@ namespace myStd
         }
 
         /**
-         * @brief Move constructor.
+         * @brief Move constructor. Never throws, so containers relocate by moving.
          * @param obj Object to move from.
          */
-        Type(Type<T> &&obj)
-        {
-            ptr = std::make_unique<T>(*(obj.ptr));
-        }
+        Type(Type<T> &&obj) noexcept : Numeric(typeTag<T>), val(std::move(obj.val)) {}
 
         // =========================
         // Assignment Operators
@@ -121,17 +156,29 @@ namespace myStd
 
         /**
          * @brief Copy assignment operator.
-         * @param val Object to copy from.
+         * @param obj Object to copy from.
          * @return Reference to this object.
          */
-        Type<T> &operator=(const Type<T> &val)
+        Type<T> &operator=(const Type<T> &obj)
         {
-            ptr = std::make_unique<T>(*(val.ptr));
+            val = obj.val;
             return *this;
         }
 
         /**
-         * @brief Assignment from unique_ptr<Numeric>. Only allowed for Type<double> and Type<Complex<double, double>>.
+         * @brief Move assignment operator.
+         * @param obj Object to move from.
+         * @return Reference to this object.
+         */
+        Type<T> &operator=(Type<T> &&obj) noexcept
+        {
+            val = std::move(obj.val);
+            return *this;
+        }
+
+        /**
+         * @brief Assignment from unique_ptr<Numeric>. Only allowed for the types mixed
+         *        operations can produce: double, float, fixed point, Complex<F, F>, PolarComplex<F> and BigInt.
          * @param uptr Unique pointer to a Numeric object.
          * @return Reference to this object.
          * @throws std::runtime_error if assignment is invalid.
@@ -139,11 +186,13 @@ namespace myStd
         Type<T> &operator=(std::unique_ptr<Numeric> uptr)
         {
             static_assert(
-                (std::is_same_v<T, Complex<double, double>>) || (std::is_same_v<T, double>),
-                "Assignment from unique_ptr<Numeric> is only allowed for Type<Complex<double, double>> or Type<double>!");
+                (std::is_same_v<T, Complex<double, double>>) || (std::is_same_v<T, double>) ||
+                    (std::is_same_v<T, Complex<float, float>>) || (std::is_same_v<T, float>) || is_fixed_v<T> || is_polar_v<T> ||
+                    (std::is_same_v<T, BigInt>),
+                "Assignment from unique_ptr<Numeric> is only allowed for promotion results (double, float, fixed point, Complex<F, F>, PolarComplex<F>, BigInt)!");
             if (auto *castedPtr = dynamic_cast<Type<T> *>(uptr.get()))
             {
-                ptr = std::make_unique<T>(*(castedPtr->ptr));
+                val = std::move(castedPtr->val);
             }
             else
             {
@@ -156,6 +205,19 @@ namespace myStd
         // Compound Assignment Operators
         // =========================
 
+        /**
+         * @brief Compound addition assignment with an object of the same type.
+         *        Resolved at compile time, no dynamic_cast.
+         * @param obj Type object to add.
+         * @return Reference to this object.
+         */
+        Type<T> &operator+=(const Type<T> &obj)
+        {
+            instrument::Probe probe(instrument::Op::AddAssign, typeTag<T>, typeTag<T>);
+            this->val += obj.val;
+            return *this;
+        }
+
         /**
          * @brief Compound addition assignment.
          * @param obj Numeric object to add.
@@ -163,14 +225,30 @@ namespace myStd
          */
         Numeric &operator+=(Numeric &obj) override
         {
-            auto castedObj = dynamic_cast<Type<T> *>(&obj);
-            if (castedObj)
-                *(this->ptr) = *(this->ptr) + *(castedObj->ptr);
-            // If T is complex, add real part and keep imaginary part
-            if constexpr (is_complex<T>::value)
-                this->ptr->real = this->ptr->real + obj.getValue();
+            instrument::Probe probe(instrument::Op::AddAssign, typeTag<T>, obj.getTag());
+            if (auto *castedObj = sameType(obj))
+                this->val += castedObj->val;
+            // A polar value stays exact: same promotion as operator+, converted back to T
+            else if constexpr (is_polar_v<T>)
+                detail::assignThrough<detail::AddKernel>(this->val, obj);
+            // If T is complex, add to the real part and keep imaginary part
+            else if constexpr (is_complex<T>::value)
+                this->val.real = this->val.real + fallbackValue(obj);
             else
-                *(this->ptr) = *(this->ptr) + static_cast<T>(obj.getValue());
+                this->val = this->val + static_cast<T>(fallbackValue(obj));
+            return *this;
+        }
+
+        /**
+         * @brief Compound subtraction assignment with an object of the same type.
+         *        Resolved at compile time, no dynamic_cast.
+         * @param obj Type object to subtract.
+         * @return Reference to this object.
+         */
+        Type<T> &operator-=(const Type<T> &obj)
+        {
+            instrument::Probe probe(instrument::Op::SubAssign, typeTag<T>, typeTag<T>);
+            this->val -= obj.val;
             return *this;
         }
 
@@ -181,13 +259,30 @@ namespace myStd
          */
         Numeric &operator-=(Numeric &obj) override
         {
-            auto castedObj = dynamic_cast<Type<T> *>(&obj);
-            if (castedObj)
-                *(this->ptr) = *(this->ptr) - *(castedObj->ptr);
-            if constexpr (is_complex<T>::value)
-                this->ptr->real = this->ptr->real - obj.getValue();
+            instrument::Probe probe(instrument::Op::SubAssign, typeTag<T>, obj.getTag());
+            if (auto *castedObj = sameType(obj))
+                this->val -= castedObj->val;
+            // A polar value stays exact: same promotion as operator-, converted back to T
+            else if constexpr (is_polar_v<T>)
+                detail::assignThrough<detail::SubKernel>(this->val, obj);
+            // If T is complex, subtract from the real part and keep imaginary part
+            else if constexpr (is_complex<T>::value)
+                this->val.real = this->val.real - fallbackValue(obj);
             else
-                *(this->ptr) = *(this->ptr) - static_cast<T>(obj.getValue());
+                this->val = this->val - static_cast<T>(fallbackValue(obj));
+            return *this;
+        }
+
+        /**
+         * @brief Compound multiplication assignment with an object of the same type.
+         *        Resolved at compile time, no dynamic_cast.
+         * @param obj Type object to multiply.
+         * @return Reference to this object.
+         */
+        Type<T> &operator*=(const Type<T> &obj)
+        {
+            instrument::Probe probe(instrument::Op::MulAssign, typeTag<T>, typeTag<T>);
+            this->val *= obj.val;
             return *this;
         }
 
@@ -198,13 +293,30 @@ namespace myStd
          */
         Numeric &operator*=(Numeric &obj) override
         {
-            auto castedObj = dynamic_cast<Type<T> *>(&obj);
-            if (castedObj)
-                *(this->ptr) = *(this->ptr) * *(castedObj->ptr);
-            if constexpr (is_complex<T>::value)
-                this->ptr->real = this->ptr->real * obj.getValue();
+            instrument::Probe probe(instrument::Op::MulAssign, typeTag<T>, obj.getTag());
+            if (auto *castedObj = sameType(obj))
+                this->val *= castedObj->val;
+            // A polar value stays exact: same promotion as operator*, converted back to T
+            else if constexpr (is_polar_v<T>)
+                detail::assignThrough<detail::MulKernel>(this->val, obj);
+            // If T is complex, scale the real part and keep imaginary part
+            else if constexpr (is_complex<T>::value)
+                this->val.real = this->val.real * fallbackValue(obj);
             else
-                *(this->ptr) = *(this->ptr) * static_cast<T>(obj.getValue());
+                this->val = this->val * static_cast<T>(fallbackValue(obj));
+            return *this;
+        }
+
+        /**
+         * @brief Compound division assignment with an object of the same type.
+         *        Resolved at compile time, no dynamic_cast.
+         * @param obj Type object to divide by.
+         * @return Reference to this object.
+         */
+        Type<T> &operator/=(const Type<T> &obj)
+        {
+            instrument::Probe probe(instrument::Op::DivAssign, typeTag<T>, typeTag<T>);
+            this->val /= obj.val;
             return *this;
         }
 
@@ -215,13 +327,17 @@ namespace myStd
          */
         Numeric &operator/=(Numeric &obj) override
         {
-            auto castedObj = dynamic_cast<Type<T> *>(&obj);
-            if (castedObj)
-                *(this->ptr) = *(this->ptr) / *(castedObj->ptr);
-            if constexpr (is_complex<T>::value)
-                this->ptr->real = this->ptr->real / obj.getValue();
+            instrument::Probe probe(instrument::Op::DivAssign, typeTag<T>, obj.getTag());
+            if (auto *castedObj = sameType(obj))
+                this->val /= castedObj->val;
+            // A polar value stays exact: same promotion as operator/, converted back to T
+            else if constexpr (is_polar_v<T>)
+                detail::assignThrough<detail::DivKernel>(this->val, obj);
+            // If T is complex, divide the real part and keep imaginary part
+            else if constexpr (is_complex<T>::value)
+                this->val.real = this->val.real / fallbackValue(obj);
             else
-                *(this->ptr) = *(this->ptr) / static_cast<T>(obj.getValue());
+                this->val = this->val / static_cast<T>(fallbackValue(obj));
             return *this;
         }
 
@@ -236,17 +352,27 @@ namespace myStd
          */
         std::unique_ptr<Numeric> operator+(Numeric &obj) override
         {
+            instrument::Probe probe(instrument::Op::Add, typeTag<T>, obj.getTag());
+            // Both types tagged: one indexed call into the dispatch table
+            if constexpr (typeTag<T> != noTag)
+                if (obj.getTag() != noTag)
+                    return detail::dispatchTable<detail::AddKernel>[typeTag<T>][obj.getTag()](*this, obj);
+            // An untagged operand is real: a polar value keeps its phase instead of falling back to double
+            if constexpr (is_polar_v<T>)
+                return detail::wrap(detail::AddKernel::compute(this->val, obj.getValue()));
+
             auto castedObj = dynamic_cast<Type<T> *>(&obj);
             // Same type
             if (castedObj)
             {
-                return std::make_unique<Type<T>>(*(this->ptr) + *(castedObj->ptr));
+                return std::make_unique<Type<T>>(this->val + castedObj->val);
             }
 
             // If first operand is complex, promote to Complex<double, double>
             if constexpr (is_complex<T>::value)
             {
-                Complex<double, double> c(this->ptr->real + obj.getValue(), this->ptr->img);
+                instrument::count(instrument::Event::CastFailure);
+                Complex<double, double> c(this->val.real + fallbackValue(obj), this->val.img);
                 return std::make_unique<Type<Complex<double, double>>>(c);
             }
             else
@@ -274,17 +400,27 @@ namespace myStd
          */
         std::unique_ptr<Numeric> operator-(Numeric &obj) override
         {
+            instrument::Probe probe(instrument::Op::Sub, typeTag<T>, obj.getTag());
+            // Both types tagged: one indexed call into the dispatch table
+            if constexpr (typeTag<T> != noTag)
+                if (obj.getTag() != noTag)
+                    return detail::dispatchTable<detail::SubKernel>[typeTag<T>][obj.getTag()](*this, obj);
+            // An untagged operand is real: a polar value keeps its phase instead of falling back to double
+            if constexpr (is_polar_v<T>)
+                return detail::wrap(detail::SubKernel::compute(this->val, obj.getValue()));
+
             auto castedObj = dynamic_cast<Type<T> *>(&obj);
             // Same type
             if (castedObj)
             {
-                return std::make_unique<Type<T>>(*(this->ptr) - *(castedObj->ptr));
+                return std::make_unique<Type<T>>(this->val - castedObj->val);
             }
 
             // If first operand is complex, promote to Complex<double, double>
             if constexpr (is_complex<T>::value)
             {
-                Complex<double, double> c(this->ptr->real - obj.getValue(), this->ptr->img);
+                instrument::count(instrument::Event::CastFailure);
+                Complex<double, double> c(this->val.real - fallbackValue(obj), this->val.img);
                 return std::make_unique<Type<Complex<double, double>>>(c);
             }
             else
@@ -314,16 +450,26 @@ namespace myStd
         std::enable_if_t<!is_complex<U>::value, std::unique_ptr<Numeric>>
         operator*(Numeric &obj)
         {
+            instrument::Probe probe(instrument::Op::Mul, typeTag<T>, obj.getTag());
+            // Both types tagged: one indexed call into the dispatch table
+            if constexpr (typeTag<T> != noTag)
+                if (obj.getTag() != noTag)
+                    return detail::dispatchTable<detail::MulKernel>[typeTag<T>][obj.getTag()](*this, obj);
+            // An untagged operand is real: a polar value keeps its phase instead of falling back to double
+            if constexpr (is_polar_v<T>)
+                return detail::wrap(detail::MulKernel::compute(this->val, obj.getValue()));
+
             auto castedObj = dynamic_cast<Type<T> *>(&obj);
             // Same type
             if (castedObj)
             {
-                return std::make_unique<Type<T>>(*(this->ptr) * *(castedObj->ptr));
+                return std::make_unique<Type<T>>(this->val * castedObj->val);
             }
 
             // If first operand is complex, promote to Complex<double, double>
             if constexpr (is_complex<T>::value)
             {
+                instrument::count(instrument::Event::ComplexError);
                 throw(std::runtime_error("Can't do this operation for complex numbers"));
             }
             else
@@ -332,6 +478,7 @@ namespace myStd
                 Complex<double, double> c_other;
                 if (extractComplexAsDouble(obj, c_other))
                 {
+                    instrument::count(instrument::Event::ComplexError);
                     throw(std::runtime_error("Can't do this operation for complex numbers"));
                 }
                 else
@@ -352,16 +499,26 @@ namespace myStd
         std::enable_if_t<!is_complex<U>::value, std::unique_ptr<Numeric>>
         operator/(Numeric &obj)
         {
+            instrument::Probe probe(instrument::Op::Div, typeTag<T>, obj.getTag());
+            // Both types tagged: one indexed call into the dispatch table
+            if constexpr (typeTag<T> != noTag)
+                if (obj.getTag() != noTag)
+                    return detail::dispatchTable<detail::DivKernel>[typeTag<T>][obj.getTag()](*this, obj);
+            // An untagged operand is real: a polar value keeps its phase instead of falling back to double
+            if constexpr (is_polar_v<T>)
+                return detail::wrap(detail::DivKernel::compute(this->val, obj.getValue()));
+
             auto castedObj = dynamic_cast<Type<T> *>(&obj);
             // Same type
             if (castedObj)
             {
-                return std::make_unique<Type<T>>(*(this->ptr) / *(castedObj->ptr));
+                return std::make_unique<Type<T>>(this->val / castedObj->val);
             }
 
             // If first operand is complex, promote to Complex<double, double>
             if constexpr (is_complex<T>::value)
             {
+                instrument::count(instrument::Event::ComplexError);
                 throw(std::runtime_error("Can't do this operation for complex numbers"));
             }
             else
@@ -370,6 +527,7 @@ namespace myStd
                 Complex<double, double> c_other;
                 if (extractComplexAsDouble(obj, c_other))
                 {
+                    instrument::count(instrument::Event::ComplexError);
                     throw(std::runtime_error("Can't do this operation for complex numbers"));
                 }
                 else
@@ -381,6 +539,34 @@ namespace myStd
             }
         }
 
+        /**
+         * @brief Multiplication of a rectangular complex value by a PolarComplex.
+         *        operator*(Numeric &) is disabled for complex T, but this product is
+         *        exact once promoted to polar, as with the operands swapped.
+         * @param obj PolarComplex operand.
+         * @return Unique pointer to the Type<PolarComplex<F>> result as Numeric.
+         */
+        template <typename F, typename U = T>
+        std::enable_if_t<is_complex<U>::value, std::unique_ptr<Numeric>>
+        operator*(Type<PolarComplex<F>> &obj)
+        {
+            instrument::Probe probe(instrument::Op::Mul, typeTag<T>, obj.getTag());
+            return detail::wrap(ops::mul(this->val, obj.val));
+        }
+
+        /**
+         * @brief Division of a rectangular complex value by a PolarComplex, see operator*(Type<PolarComplex<F>> &).
+         * @param obj PolarComplex operand.
+         * @return Unique pointer to the Type<PolarComplex<F>> result as Numeric.
+         */
+        template <typename F, typename U = T>
+        std::enable_if_t<is_complex<U>::value, std::unique_ptr<Numeric>>
+        operator/(Type<PolarComplex<F>> &obj)
+        {
+            instrument::Probe probe(instrument::Op::Div, typeTag<T>, obj.getTag());
+            return detail::wrap(ops::div(this->val, obj.val));
+        }
+
         // =========================
         // Comparison Operators
         // =========================
@@ -392,9 +578,16 @@ namespace myStd
          */
         bool operator<(Numeric &obj) override
         {
+            instrument::Probe probe(instrument::Op::Less, typeTag<T>, obj.getTag());
+            // Both types tagged: one indexed call into the dispatch table
+            if constexpr (typeTag<T> != noTag)
+                if (obj.getTag() != noTag)
+                    return detail::dispatchTable<detail::LessKernel>[typeTag<T>][obj.getTag()](*this, obj);
+
             Type<T> *castedObj = dynamic_cast<Type<T> *>(&obj);
             if (typeid(*this) == typeid(castedObj))
-                return *(this->ptr) < *(castedObj->ptr);
+                return this->val < castedObj->val;
+            instrument::count(instrument::Event::CastFailure);
 
             return this->getValue() < obj.getValue();
         }
@@ -406,7 +599,11 @@ namespace myStd
          */
         bool operator>(Numeric &obj) override
         {
-            return *(this->ptr) > *(dynamic_cast<Type<T> &>(obj).ptr);
+            instrument::Probe probe(instrument::Op::Greater, typeTag<T>, obj.getTag());
+            if constexpr (instrument::enabled)
+                if (!sameType(obj))
+                    instrument::count(instrument::Event::CastFailure);
+            return this->val > dynamic_cast<Type<T> &>(obj).val;
         }
 
         /**
@@ -416,7 +613,11 @@ namespace myStd
          */
         bool operator==(Numeric &obj) override
         {
-            return *(this->ptr) == *(dynamic_cast<Type<T> &>(obj).ptr);
+            instrument::Probe probe(instrument::Op::Equal, typeTag<T>, obj.getTag());
+            if constexpr (instrument::enabled)
+                if (!sameType(obj))
+                    instrument::count(instrument::Event::CastFailure);
+            return this->val == dynamic_cast<Type<T> &>(obj).val;
         }
 
         // =========================
@@ -431,7 +632,7 @@ namespace myStd
          */
         friend std::ostream &operator<<(std::ostream &os, const Type<T> &obj)
         {
-            os << *(obj.ptr);
+            os << obj.val;
             return os;
         }
 
@@ -443,12 +644,7 @@ namespace myStd
          */
         friend std::istream &operator>>(std::istream &is, Type<T> &obj)
         {
-            T in;
-            is >> in;
-            if (obj.ptr)
-                *(obj.ptr) = in;
-            else
-                obj.ptr = std::make_unique<T>(in);
+            is >> obj.val;
             return is;
         }
 
@@ -463,20 +659,29 @@ namespace myStd
             return os;
         }
 
+        /**
+         * @brief Returns the stored value.
+         * @return Const reference to the value of type T.
+         */
+        const T &get() const
+        {
+            return val;
+        }
+
         /**
          * @brief Returns the value as double.
-         *        For complex types, returns the magnitude.
+         *        For complex types, returns the magnitude; for PolarComplex that is a field read.
          * @return Value as double.
          */
         double getValue()
         {
-            if constexpr (is_complex<T>::value)
+            if constexpr (is_complex<T>::value || is_polar_v<T>)
             {
-                return static_cast<double>(this->ptr->getValue());
+                return static_cast<double>(this->val.getValue());
             }
             else
             {
-                return static_cast<double>(*(this->ptr));
+                return static_cast<double>(this->val);
             }
         }
     };
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+#include "Complex.hpp"
+#include "Fixed.hpp"
+#include "Polar.hpp"
+#include "BigInt.hpp"
+
+/**
+ * @file TypeTag.hpp
+ * @brief Compile-time list of the built-in numeric types and the small integral
+ *        tag each Type<T> carries to identify its T without RTTI.
+ */
+
+namespace myStd
+{
+    /**
+     * @brief Compile-time list of types.
+     */
+    template <typename... Ts>
+    struct TypeList
+    {
+        static constexpr std::size_t size = sizeof...(Ts);
+
+        /// Instantiates F with the listed types, e.g. TypeList<A, B>::apply<std::variant>.
+        template <template <typename...> class F>
+        using apply = F<Ts...>;
+    };
+
+    /**
+     * @brief Types with a tag. The position in this list is the tag value, so new
+     *        types must be appended.
+     */
+    using NumericTypes = TypeList<int, double,
+                                  Complex<int, int>, Complex<double, double>,
+                                  Complex<int, double>, Complex<double, int>,
+                                  float, Complex<float, float>, Q15, Q31,
+                                  PolarComplex<double>, PolarComplex<float>, BigInt>;
+
+    /// Small integral type identifier stored in every Numeric.
+    using TypeTag = unsigned char;
+
+    /// Tag of types that are not listed in NumericTypes.
+    constexpr TypeTag noTag = 0xFF;
+
+    /**
+     * @brief Position of T in a TypeList, or noTag if absent.
+     */
+    template <typename T, typename List>
+    struct IndexOf;
+
+    template <typename T>
+    struct IndexOf<T, TypeList<>> : std::integral_constant<TypeTag, noTag>
+    {
+    };
+
+    template <typename T, typename... Ts>
+    struct IndexOf<T, TypeList<T, Ts...>> : std::integral_constant<TypeTag, 0>
+    {
+    };
+
+    template <typename T, typename Head, typename... Ts>
+    struct IndexOf<T, TypeList<Head, Ts...>>
+        : std::integral_constant<TypeTag, IndexOf<T, TypeList<Ts...>>::value == noTag
+                                              ? noTag
+                                              : IndexOf<T, TypeList<Ts...>>::value + 1>
+    {
+    };
+
+    /// Tag of T, or noTag if T is not in NumericTypes.
+    template <typename T>
+    constexpr TypeTag typeTag = IndexOf<T, NumericTypes>::value;
+}
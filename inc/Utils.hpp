@@ -1,6 +1,10 @@
 #pragma once
 #include <iostream>
+#include <type_traits>
 #include "Complex.hpp"
+#include "Fixed.hpp"
+#include "Polar.hpp"
+#include "BigInt.hpp"
 
 /**
  * @file Utils.hpp
@@ -28,4 +32,121 @@ template <typename T, typename U>
 struct is_complex<myStd::Complex<T, U>> : std::true_type
 {
     // Any myStd::Complex<T, U> is considered complex.
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Shorthand for is_complex<T>::value.
+ */
+template <typename T>
+inline constexpr bool is_complex_v = is_complex<T>::value;
+
+/**
+ * @brief Type trait to detect if a type is a specialization of myStd::Fixed.
+ */
+template <typename>
+struct is_fixed : std::false_type
+{
+};
+
+template <typename Raw, int FRAC>
+struct is_fixed<myStd::Fixed<Raw, FRAC>> : std::true_type
+{
+};
+
+/**
+ * @brief Shorthand for is_fixed<T>::value.
+ */
+template <typename T>
+inline constexpr bool is_fixed_v = is_fixed<T>::value;
+
+/**
+ * @brief Type trait to detect if a type is a specialization of myStd::PolarComplex.
+ */
+template <typename>
+struct is_polar : std::false_type
+{
+};
+
+template <typename F>
+struct is_polar<myStd::PolarComplex<F>> : std::true_type
+{
+};
+
+/**
+ * @brief Shorthand for is_polar<T>::value.
+ */
+template <typename T>
+inline constexpr bool is_polar_v = is_polar<T>::value;
+
+/**
+ * @brief true when * and / between A and B are rejected: a rectangular complex
+ *        operand and no polar one. With a polar operand both sides are
+ *        converted to polar form, where products and quotients are cheap.
+ */
+template <typename A, typename B>
+inline constexpr bool rejects_mul_div_v = (is_complex_v<A> || is_complex_v<B>) && !(is_polar_v<A> || is_polar_v<B>);
+
+/**
+ * @brief true for the types integer arithmetic stays exact in: built-in integers and myStd::BigInt.
+ */
+template <typename T>
+inline constexpr bool is_exact_integer_v = std::is_integral_v<T> || std::is_same_v<T, myStd::BigInt>;
+
+/**
+ * @brief true for the 32-bit-or-narrower types that promotion keeps narrow:
+ *        float, Complex<float, float>, PolarComplex<float> and fixed point.
+ */
+template <typename T>
+inline constexpr bool is_narrow_v = std::is_same_v<T, float> ||
+                                    std::is_same_v<T, myStd::Complex<float, float>> ||
+                                    std::is_same_v<T, myStd::PolarComplex<float>> ||
+                                    is_fixed_v<T>;
+
+/**
+ * @brief Result type of mixed-type arithmetic between A and B.
+ *
+ * Encodes the promotion rules of Type<T> at compile time:
+ *  - same type                 -> that type
+ *  - BigInt and an integer     -> myStd::BigInt, so integer arithmetic stays exact
+ *  - either operand is polar   -> myStd::PolarComplex<float> if both operands
+ *                                 are narrow, myStd::PolarComplex<double> otherwise
+ *  - either operand is complex -> myStd::Complex<float, float> if both operands
+ *                                 are narrow, myStd::Complex<double, double> otherwise
+ *  - both fixed point          -> the wider of the two
+ *  - both narrow               -> float
+ *  - otherwise                 -> double
+ *
+ * So float, Complex<float, float>, Q15 and Q31 never widen to double among
+ * themselves; mixing with int or double gives double as before. BigInt mixed
+ * with anything but an integer takes the rules above, like a wide int.
+ */
+template <typename A, typename B>
+struct promote
+{
+    using type = std::conditional_t<
+        std::is_same_v<A, B>, A,
+        std::conditional_t<
+            (std::is_same_v<A, myStd::BigInt> || std::is_same_v<B, myStd::BigInt>) &&
+                is_exact_integer_v<A> && is_exact_integer_v<B>,
+            myStd::BigInt,
+            std::conditional_t<
+                is_polar_v<A> || is_polar_v<B>,
+                std::conditional_t<is_narrow_v<A> && is_narrow_v<B>,
+                                   myStd::PolarComplex<float>,
+                                   myStd::PolarComplex<double>>,
+                std::conditional_t<
+                    is_complex_v<A> || is_complex_v<B>,
+                    std::conditional_t<is_narrow_v<A> && is_narrow_v<B>,
+                                       myStd::Complex<float, float>,
+                                       myStd::Complex<double, double>>,
+                    std::conditional_t<
+                        is_fixed_v<A> && is_fixed_v<B>,
+                        std::conditional_t<(sizeof(A) >= sizeof(B)), A, B>,
+                        std::conditional_t<is_narrow_v<A> && is_narrow_v<B>, float, double>>>>>>;
+};
+
+/**
+ * @brief Shorthand for promote<A, B>::type.
+ */
+template <typename A, typename B>
+using promote_t = typename promote<A, B>::type;
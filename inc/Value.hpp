@@ -0,0 +1,192 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <variant>
+
+#include "Utils.hpp"
+#include "Complex.hpp"
+#include "Promotion.hpp"
+#include "TypeTag.hpp"
+
+namespace myStd
+{
+    /**
+     * @brief Value type holding any of the built-in numeric types without heap allocation.
+     *
+     * Static-dispatch counterpart of Numeric: operators are resolved with std::visit
+     * over a closed set of types instead of virtual calls and dynamic_cast, and
+     * results are returned by value. Promotion follows the same rules as Type<T>
+     * (see ops::add). Numeric and Type<T> remain available for existing callers.
+     */
+    class Value
+    {
+    public:
+        /// Closed set of types a Value can hold. The variant index equals the type's tag.
+        using Storage = NumericTypes::apply<std::variant>;
+
+    private:
+        Storage v;
+
+    public:
+        // =========================
+        // Constructors
+        // =========================
+
+        /**
+         * @brief Default constructor. Holds int 0.
+         */
+        Value() = default;
+
+        /**
+         * @brief Construct from any of the supported types.
+         * @param val Initial value.
+         */
+        template <typename T,
+                  typename = std::enable_if_t<std::is_constructible_v<Storage, T> &&
+                                              !std::is_same_v<std::decay_t<T>, Value>>>
+        Value(T val) : v(val) {}
+
+        // =========================
+        // Arithmetic Operators
+        // =========================
+
+        /**
+         * @brief Addition operator. Handles same and mixed types.
+         * @param obj Value to add.
+         * @return Sum as a new Value.
+         */
+        Value operator+(const Value &obj) const
+        {
+            return std::visit([](const auto &a, const auto &b) -> Value
+                              { return ops::add(a, b); },
+                              v, obj.v);
+        }
+
+        /**
+         * @brief Subtraction operator. Handles same and mixed types.
+         * @param obj Value to subtract.
+         * @return Difference as a new Value.
+         */
+        Value operator-(const Value &obj) const
+        {
+            return std::visit([](const auto &a, const auto &b) -> Value
+                              { return ops::sub(a, b); },
+                              v, obj.v);
+        }
+
+        /**
+         * @brief Multiplication operator.
+         * @param obj Value to multiply.
+         * @return Product as a new Value.
+         * @throws std::runtime_error if an operand is rectangular complex and neither is polar.
+         */
+        Value operator*(const Value &obj) const
+        {
+            return std::visit([](const auto &a, const auto &b) -> Value
+                              {
+                using L = std::decay_t<decltype(a)>;
+                using R = std::decay_t<decltype(b)>;
+                if constexpr (rejects_mul_div_v<L, R>)
+                    throw(std::runtime_error("Can't do this operation for complex numbers"));
+                else
+                    return ops::mul(a, b); },
+                              v, obj.v);
+        }
+
+        /**
+         * @brief Division operator.
+         * @param obj Value to divide by.
+         * @return Quotient as a new Value.
+         * @throws std::runtime_error if an operand is rectangular complex and neither is polar.
+         */
+        Value operator/(const Value &obj) const
+        {
+            return std::visit([](const auto &a, const auto &b) -> Value
+                              {
+                using L = std::decay_t<decltype(a)>;
+                using R = std::decay_t<decltype(b)>;
+                if constexpr (rejects_mul_div_v<L, R>)
+                    throw(std::runtime_error("Can't do this operation for complex numbers"));
+                else
+                    return ops::div(a, b); },
+                              v, obj.v);
+        }
+
+        // =========================
+        // Comparison Operators
+        // =========================
+
+        /**
+         * @brief Less-than comparison operator (by value, magnitude for complex).
+         * @param obj Value to compare.
+         * @return true if this value is less than obj.
+         */
+        bool operator<(const Value &obj) const
+        {
+            return std::visit([](const auto &a, const auto &b)
+                              { return ops::less(a, b); },
+                              v, obj.v);
+        }
+
+        /**
+         * @brief Greater-than comparison operator (by value, magnitude for complex).
+         * @param obj Value to compare.
+         * @return true if this value is greater than obj.
+         */
+        bool operator>(const Value &obj) const
+        {
+            return obj < *this;
+        }
+
+        // =========================
+        // Accessors
+        // =========================
+
+        /**
+         * @brief Checks whether the held value has type T.
+         * @return true if the held value is a T.
+         */
+        template <typename T>
+        bool holds() const
+        {
+            return std::holds_alternative<T>(v);
+        }
+
+        /**
+         * @brief Returns the held value as T.
+         * @return Held value.
+         * @throws std::bad_variant_access if the held value is not a T.
+         */
+        template <typename T>
+        const T &get() const
+        {
+            return std::get<T>(v);
+        }
+
+        /**
+         * @brief Returns the value as double.
+         *        For complex types, returns the magnitude.
+         * @return Value as double.
+         */
+        double getValue() const
+        {
+            return std::visit([](const auto &a)
+                              { return ops::valueOf(a); },
+                              v);
+        }
+
+        /**
+         * @brief Output stream operator.
+         * @param os Output stream.
+         * @param obj Value to print.
+         * @return Reference to the output stream.
+         */
+        friend std::ostream &operator<<(std::ostream &os, const Value &obj)
+        {
+            std::visit([&os](const auto &a)
+                       { os << a; },
+                       obj.v);
+            return os;
+        }
+    };
+}
@@ -4,6 +4,7 @@
 #include "../inc/Numeric.hpp"
 #include "../inc/Type.hpp"
 #include "../inc/Complex.hpp"
+#include "../inc/Sort.hpp"
 
 int main()
 {
@@ -145,9 +146,8 @@ int main()
     v.push_back(std::make_unique<myStd::Type<int>>(i2));
     v.push_back(std::make_unique<myStd::Type<double>>(d1));
 
-    std::sort(v.begin(), v.end(),
-              [](const auto &a, const auto &b)
-              { return *a < *b; });
+    // Ascending order, with one getValue() call per element
+    myStd::sortByValue(v);
 
     std::cout << "Sorted vector:" << std::endl;
     for (auto &i : v)
@@ -0,0 +1,58 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @file Check.hpp
+ * @brief Minimal assertion helpers shared by the test executables.
+ *
+ * Each test is a standalone program that prints the failed checks and
+ * returns a nonzero exit code if there were any.
+ */
+
+namespace check
+{
+    inline int failures = 0;
+
+    /**
+     * @brief Records a failure, with its description, if ok is false.
+     * @param ok Checked condition.
+     * @param what Description printed on failure.
+     */
+    inline void expect(bool ok, const char *what)
+    {
+        if (!ok)
+        {
+            ++failures;
+            std::cerr << "FAILED: " << what << std::endl;
+        }
+    }
+
+    /**
+     * @brief Records a failure unless fn throws std::runtime_error.
+     * @param fn Callable expected to throw.
+     * @param what Description printed on failure.
+     */
+    template <typename F>
+    void expectThrow(F &&fn, const char *what)
+    {
+        try
+        {
+            fn();
+        }
+        catch (const std::runtime_error &)
+        {
+            return;
+        }
+        expect(false, what);
+    }
+
+    /**
+     * @brief Exit code of the test program: 0 if every check passed.
+     */
+    inline int result()
+    {
+        std::cout << (failures ? "FAILED" : "OK") << " (" << failures << " failures)" << std::endl;
+        return failures ? 1 : 0;
+    }
+}
@@ -0,0 +1,127 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include "Check.hpp"
+#include "../inc/Type.hpp"
+
+/**
+ * @file test_polar_assign.cpp
+ * @brief Compound operators of Type<PolarComplex<F>> against the binary operators,
+ *        for a right operand of every tagged type, plus rectangular complex
+ *        times/over PolarComplex in both orders.
+ *
+ * Build: g++ -std=c++17 tests/test_polar_assign.cpp -o test_polar_assign
+ */
+
+namespace
+{
+    using myStd::BigInt;
+    using myStd::Complex;
+    using myStd::Numeric;
+    using myStd::PolarComplex;
+    using myStd::Type;
+
+    /// Value of a binary operator's result, which is a PolarComplex of either precision.
+    template <typename F>
+    PolarComplex<F> polarOf(const Numeric &r)
+    {
+        if (r.getTag() == myStd::typeTag<PolarComplex<double>>)
+            return PolarComplex<F>(static_cast<const Type<PolarComplex<double>> &>(r).get());
+        return PolarComplex<F>(static_cast<const Type<PolarComplex<float>> &>(r).get());
+    }
+
+    bool same(const PolarComplex<double> &a, const PolarComplex<double> &b, double tolerance = 0)
+    {
+        return std::abs(a.magnitude() - b.magnitude()) <= tolerance * b.magnitude() &&
+               std::abs(a.argument() - b.argument()) <= tolerance;
+    }
+
+    /// Checks a op= b against a op b for the four operators.
+    template <typename F>
+    void compoundMatchesBinary(const PolarComplex<F> &start, Numeric &b, const std::string &name)
+    {
+        for (char op : {'+', '-', '*', '/'})
+        {
+            Type<PolarComplex<F>> a(start), lhs(start);
+            std::unique_ptr<Numeric> r;
+            switch (op)
+            {
+            case '+':
+                r = lhs + b;
+                a += b;
+                break;
+            case '-':
+                r = lhs - b;
+                a -= b;
+                break;
+            case '*':
+                r = lhs * b;
+                a *= b;
+                break;
+            default:
+                r = lhs / b;
+                a /= b;
+            }
+            PolarComplex<F> expected = polarOf<F>(*r), got = a.get();
+            std::string what = "a " + std::string(1, op) + "= " + name + " equals a " + op + " " + name;
+            check::expect(got.magnitude() == expected.magnitude() && got.argument() == expected.argument(), what.c_str());
+        }
+    }
+
+    template <typename F>
+    void allOperands()
+    {
+        PolarComplex<F> a(Complex<F, F>(3, 4));
+        Type<int> i(2);
+        Type<double> d(-1.5);
+        Type<float> f(0.25f);
+        Type<myStd::Q15> q(myStd::Q15(0.5));
+        Type<BigInt> big(BigInt(7));
+        Type<Complex<int, int>> ci(Complex<int, int>(1, 1));
+        Type<Complex<double, double>> cd(Complex<double, double>(1, 1));
+        Type<Complex<int, double>> cid(Complex<int, double>(2, -0.5));
+        Type<Complex<double, int>> cdi(Complex<double, int>(-1.5, 3));
+        Type<Complex<float, float>> cf(Complex<float, float>(0.5f, 2.0f));
+        Type<PolarComplex<double>> pd(PolarComplex<double>(2.0, 1.0));
+        Type<PolarComplex<float>> pf(PolarComplex<float>(0.5f, -2.0f));
+        Type<long> untagged(3);
+
+        compoundMatchesBinary(a, i, "int");
+        compoundMatchesBinary(a, d, "double");
+        compoundMatchesBinary(a, f, "float");
+        compoundMatchesBinary(a, q, "Q15");
+        compoundMatchesBinary(a, big, "BigInt");
+        compoundMatchesBinary(a, ci, "Complex<int, int>");
+        compoundMatchesBinary(a, cd, "Complex<double, double>");
+        compoundMatchesBinary(a, cid, "Complex<int, double>");
+        compoundMatchesBinary(a, cdi, "Complex<double, int>");
+        compoundMatchesBinary(a, cf, "Complex<float, float>");
+        compoundMatchesBinary(a, pd, "PolarComplex<double>");
+        compoundMatchesBinary(a, pf, "PolarComplex<float>");
+        compoundMatchesBinary(a, untagged, "long");
+    }
+}
+
+int main()
+{
+    allOperands<double>();
+    allOperands<float>();
+
+    // The cases from the review: (3 + 4i) * (1 + i) = (-1 + 7i), (3 + 4i) + (1 + i) = (4 + 5i)
+    Type<PolarComplex<double>> a(PolarComplex<double>(Complex<double, double>(3, 4)));
+    Type<Complex<double, double>> c(Complex<double, double>(1, 1));
+    a *= c;
+    check::expect(same(a.get(), PolarComplex<double>(Complex<double, double>(-1, 7)), 1e-12), "(3 + 4i) *= (1 + i) is (-1 + 7i)");
+    Type<PolarComplex<double>> b(PolarComplex<double>(Complex<double, double>(3, 4)));
+    b += c;
+    check::expect(same(b.get(), PolarComplex<double>(Complex<double, double>(4, 5)), 1e-12), "(3 + 4i) += (1 + i) is (4 + 5i)");
+
+    // Rectangular complex on the left of * and / promotes to polar, as with the operands swapped
+    Type<PolarComplex<double>> p(PolarComplex<double>(Complex<double, double>(3, 4)));
+    std::unique_ptr<Numeric> left = c * p, right = p * c, quotient = c / p;
+    check::expect(same(polarOf<double>(*left), polarOf<double>(*right)), "Complex * PolarComplex equals PolarComplex * Complex");
+    check::expect(same(polarOf<double>(*quotient), PolarComplex<double>(Complex<double, double>(0.28, -0.04)), 1e-12),
+                  "(1 + i) / (3 + 4i) is (0.28 - 0.04i)");
+
+    return check::result();
+}
@@ -0,0 +1,42 @@
+#include <vector>
+#include "Check.hpp"
+#include "../inc/Reduce.hpp"
+
+/**
+ * @file test_reduce.cpp
+ * @brief argMax/argMin and maxElement/minElement, including empty input.
+ *
+ * Build: g++ -std=c++17 tests/test_reduce.cpp -o test_reduce
+ */
+
+int main()
+{
+    using myStd::Complex;
+    using myStd::NumericVector;
+
+    std::vector<double> x = {3, -7, 9, 9, -7, 1, 2, 0, 5};
+    check::expect(myStd::argMax(x.data(), x.size()) == 2, "argMax returns the first maximum");
+    check::expect(myStd::argMin(x.data(), x.size()) == 1, "argMin returns the first minimum");
+    check::expect(myStd::maxElement(x.data(), x.size()) == 9, "maxElement");
+
+    std::vector<Complex<double, double>> c = {{1, 1}, {0, -3}, {2, 2}};
+    check::expect(myStd::argMax(c.data(), c.size()) == 1, "argMax compares complex values by magnitude");
+
+    NumericVector<Complex<double, double>> v = {{1, 1}, {0, -3}, {2, 2}};
+    check::expect(myStd::argMin(v) == 0, "argMin over a split complex NumericVector");
+
+    // Empty input has no extreme element: every variant throws instead of reading data[0]
+    std::vector<double> none;
+    check::expectThrow([&]
+                       { myStd::argMax(none.data(), 0); }, "argMax of an empty array throws");
+    check::expectThrow([&]
+                       { myStd::argMin(none.data(), 0); }, "argMin of an empty array throws");
+    check::expectThrow([&]
+                       { myStd::minElement(none.data(), 0); }, "minElement of an empty array throws");
+    check::expectThrow([&]
+                       { myStd::argMax(NumericVector<double>()); }, "argMax of an empty NumericVector throws");
+    check::expectThrow([&]
+                       { myStd::argMin(NumericVector<Complex<double, double>>()); }, "argMin of an empty complex NumericVector throws");
+
+    return check::result();
+}
@@ -0,0 +1,53 @@
+#include <memory>
+#include <vector>
+#include "Check.hpp"
+#include "../inc/Type.hpp"
+#include "../inc/Sort.hpp"
+
+/**
+ * @file test_sort.cpp
+ * @brief sortByValue on mixed collections, including BigInts that getValue() can't tell apart.
+ *
+ * Build: g++ -std=c++17 -pthread tests/test_sort.cpp -o test_sort
+ */
+
+namespace
+{
+    using myStd::BigInt;
+    using myStd::Numeric;
+    using myStd::Type;
+    using Ptrs = std::vector<std::unique_ptr<Numeric>>;
+
+    bool sortedByLess(Ptrs &v)
+    {
+        for (std::size_t i = 1; i < v.size(); ++i)
+            if (*v[i] < *v[i - 1])
+                return false;
+        return true;
+    }
+}
+
+int main()
+{
+    // 2^53 + 1 and 2^53 have the same getValue(), but operator< tells them apart
+    Ptrs big;
+    big.push_back(std::make_unique<Type<BigInt>>(BigInt("9007199254740993")));
+    big.push_back(std::make_unique<Type<BigInt>>(BigInt("9007199254740992")));
+    big.push_back(std::make_unique<Type<int>>(-4));
+    myStd::sortByValue(big);
+    check::expect(sortedByLess(big), "BigInts past 2^53 are sorted under operator<");
+    check::expect(static_cast<Type<BigInt> &>(*big[1]).get() == BigInt("9007199254740992"), "2^53 before 2^53 + 1");
+
+    // Without BigInts the key sort keeps equal values in input order
+    Ptrs mixed;
+    mixed.push_back(std::make_unique<Type<double>>(2.5));
+    mixed.push_back(std::make_unique<Type<int>>(1));
+    mixed.push_back(std::make_unique<Type<double>>(1.0));
+    mixed.push_back(std::make_unique<Type<int>>(-3));
+    Numeric *firstOne = mixed[1].get();
+    myStd::sortByValue(mixed);
+    check::expect(sortedByLess(mixed), "mixed int/double collection is sorted");
+    check::expect(mixed[1].get() == firstOne, "equal keys keep their relative order");
+
+    return check::result();
+}